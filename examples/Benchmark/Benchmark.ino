@@ -0,0 +1,189 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include <Arduino.h>
+#include "RcSwitchTransmitter.hpp"
+#include "Whitening.hpp"
+
+/*
+ * Measures the hot paths of the library on the target and prints the results
+ * as CSV lines, that can be captured from the serial monitor and compared
+ * between library versions:
+ *
+ *   benchmark,parameter,iterations,usec,metric,value
+ *
+ * send:      The overhead of the encoder is the measured frame duration minus the
+ *            nominal frame duration given by the timing spec. It is reported in
+ *            usec and CPU cycles per pulse pair.
+ * send_static: The same for sendStatic().
+ * whitening: Duration of computeWhitening() for different payload sizes.
+ * dump:      Duration of dumping the timing spec table to the serial.
+ *
+ * extras/test/HostBenchmark runs the same benchmarks on the host (make bench).
+ */
+
+DATA_ISR_ATTR static const TxProtocolTable <
+  //               clk,syA,  syB,  d0A,d0B,  d1A,d1B, inverseLevel                protocol index implicitly given by position
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>, // (PT2262)         [0]
+  makeTxTimingSpec<100, 30,   71,    4, 11,    9,  6, false>, // ()               [1]
+  makeTxTimingSpec<450,  1,   23,    1,  2,    2,  1, true>   // (HT6P20B)        [2]
+> txProtocolTable;
+
+#if defined (ARDUINO_AVR_UNO)
+constexpr int TX433_DATA_PIN = 13;
+#else
+constexpr int TX433_DATA_PIN = 7;
+#endif
+
+// Reference to the serial to be used for printing.
+typeof(Serial)& output = Serial;
+
+static RcSwitchTransmitter<TX433_DATA_PIN> rcSwitchTransmitter;
+
+static constexpr size_t REPEAT_CNT = 3;
+
+static uint32_t pulsePairDuration(const RcSwitchTx::TxPulsePairTime& pulsePair) {
+  return static_cast<uint32_t>(pulsePair.durationA) + pulsePair.durationB;
+}
+
+// The frame duration in usec, if there was no overhead at all.
+static uint32_t nominalFrameDuration(const RcSwitchTx::TxTimingSpec& timingSpec,
+    const uint32_t code, const size_t bitCount) {
+  uint32_t bitsDuration = 0;
+  for(size_t bitPos = bitCount; bitPos > 0;) {
+    --bitPos;
+    bitsDuration += pulsePairDuration((code >> bitPos) & 1 ?
+        timingSpec.data1pulsePair : timingSpec.data0pulsePair);
+  }
+  const uint32_t synchDuration = pulsePairDuration(timingSpec.synchronizationPulsePair);
+  return (synchDuration + REPEAT_CNT * (bitsDuration + synchDuration)) / RcSwitchTx::TICKS_PER_USEC;
+}
+
+static void printResultPrefix(const char* benchmark, const uint32_t parameter, const uint32_t iterations,
+    const uint32_t usec, const char* metric) {
+  output.print(benchmark);
+  output.print(',');
+  output.print(parameter);
+  output.print(',');
+  output.print(iterations);
+  output.print(',');
+  output.print(usec);
+  output.print(',');
+  output.print(metric);
+  output.print(',');
+}
+
+static void printResult(const char* benchmark, const uint32_t parameter, const uint32_t iterations,
+    const uint32_t usec, const char* metric, const uint32_t value) {
+  printResultPrefix(benchmark, parameter, iterations, usec, metric);
+  output.println(value);
+}
+
+// For values, that may be negative, e.g. the overhead, if the timing correction over-compensates.
+static void printSignedResult(const char* benchmark, const uint32_t parameter, const uint32_t iterations,
+    const uint32_t usec, const char* metric, const int32_t value) {
+  printResultPrefix(benchmark, parameter, iterations, usec, metric);
+  output.println(value);
+}
+
+// Measure send() or, if sendStatic is true, the compile time specialized sendStatic().
+static void benchmarkSend(const size_t protocolIndex, const uint32_t code, const size_t bitCount,
+    const bool sendStatic) {
+  const char* const benchmark = sendStatic ? "send_static" : "send";
+  const RcSwitchTx::TxTimingSpec& timingSpec = txProtocolTable.toTimingSpecTable().start[protocolIndex];
+  const uint32_t nominal = nominalFrameDuration(timingSpec, code, bitCount);
+  const uint32_t pulsePairCount = 1 + REPEAT_CNT * (bitCount + 1);
+
+  const uint32_t start = micros();
+  if(sendStatic) {
+    rcSwitchTransmitter.sendStatic(txProtocolTable, protocolIndex, code, bitCount);
+  } else {
+    rcSwitchTransmitter.send(protocolIndex, code, bitCount);
+  }
+  const uint32_t usec = micros() - start;
+
+  const int32_t overhead = static_cast<int32_t>(usec - nominal);
+  const int32_t overheadPerPulsePair = overhead / static_cast<int32_t>(pulsePairCount);
+  printResult(benchmark, protocolIndex, 1, usec, "bits_per_sec", (1000000UL * bitCount * REPEAT_CNT) / usec);
+  printSignedResult(benchmark, protocolIndex, 1, usec, "overhead_usec_per_pulse_pair", overheadPerPulsePair);
+#if defined(F_CPU)
+  printSignedResult(benchmark, protocolIndex, 1, usec, "overhead_cycles_per_pulse_pair",
+      overheadPerPulsePair * static_cast<int32_t>(F_CPU / 1000000UL));
+#endif
+}
+
+static void benchmarkWhitening(const size_t byteCount) {
+  static constexpr uint32_t ITERATIONS = 100;
+  static uint8_t buffer[64];
+  for(size_t i = 0; i < byteCount; i++) {
+    buffer[i] = i;
+  }
+
+  const uint32_t start = micros();
+  for(uint32_t i = 0; i < ITERATIONS; i++) {
+    RcSwitchTx::computeWhitening(buffer, 8 * byteCount);
+  }
+  const uint32_t usec = micros() - start;
+
+  printResult("whitening", byteCount, ITERATIONS, usec, "bits_per_sec",
+      static_cast<uint32_t>((1000000ULL * 8 * byteCount * ITERATIONS) / (usec ? usec : 1)));
+}
+
+static uint32_t benchmarkDump() {
+  const uint32_t start = micros();
+  txProtocolTable.dumpTimingSpec(output);
+  output.flush();
+  return micros() - start;
+}
+
+void setup()
+{
+  output.begin(115200);
+  output.println("\n>>>>>>>> Benchmark <<<<<<<<\n");
+  rcSwitchTransmitter.begin(txProtocolTable.toTimingSpecTable());
+  rcSwitchTransmitter.setRepeatCount(REPEAT_CNT);
+
+  const uint32_t dumpUsec = benchmarkDump();
+  output.println();
+  output.println("benchmark,parameter,iterations,usec,metric,value");
+  printResult("dump", txProtocolTable.ROW_COUNT, 1, dumpUsec, "usec_per_row", dumpUsec / txProtocolTable.ROW_COUNT);
+
+  // Let the printing finish, so that the serial interrupts don't disturb the measurement.
+  output.flush();
+  for(size_t protocolIndex = 0; protocolIndex < txProtocolTable.ROW_COUNT; protocolIndex++) {
+    benchmarkSend(protocolIndex, 0x55AA55, 24, false);
+    output.flush();
+    benchmarkSend(protocolIndex, 0x55AA55, 24, true);
+    output.flush();
+  }
+
+  const size_t byteCounts[] = {1, 4, 16, 64};
+  for(size_t i = 0; i < sizeof(byteCounts) / sizeof(byteCounts[0]); i++) {
+    benchmarkWhitening(byteCounts[i]);
+  }
+}
+
+void loop()
+{
+}
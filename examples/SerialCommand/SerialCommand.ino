@@ -0,0 +1,63 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include <Arduino.h>
+#include "RcSwitchTransmitter.hpp"
+#include "TxCommandServer.hpp"
+
+// Drive the transmitter from a host over the serial link. The host sends binary
+// commands, e.g. with the host tool in extras/TxCommandHost:
+//
+//   echo "0 24 5592332" | ./txcmd /dev/ttyUSB0
+//
+// Don't print anything else to the serial, because it would corrupt the responses.
+
+DATA_ISR_ATTR static const TxProtocolTable <
+  //               clk,syA,  syB,  d0A,d0B,  d1A,d1B, inverseLevel                protocol index implicitly given by position
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>, // (PT2262)         [0]
+  makeTxTimingSpec<650,  1,   10,    1,  3,    3,  1, false>, // ()               [1]
+  makeTxTimingSpec<450,  1,   23,    1,  2,    2,  1, true>,  // (HT6P20B)        [2]
+  // Note that last row must not end with a comma.
+  makeTxTimingSpec<300, 2,   23,    2,  4,    4,  2, false>  // (Sygonix)        [3]
+> txProtocolTable;
+
+#if defined (ARDUINO_AVR_UNO)
+constexpr int TX433_DATA_PIN = 13;
+#else
+constexpr int TX433_DATA_PIN = 7;
+#endif
+
+static RcSwitchTransmitter<TX433_DATA_PIN> rcSwitchTransmitter;
+static TxCommandServer<TX433_DATA_PIN> txCommandServer(rcSwitchTransmitter, Serial);
+
+void setup()
+{
+  Serial.begin(115200);
+  rcSwitchTransmitter.begin(txProtocolTable.toTimingSpecTable());
+}
+
+void loop()
+{
+  txCommandServer.handle();
+}
@@ -0,0 +1,383 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/*
+ * Host side encoder for the binary command protocol of TxCommandServer.
+ *
+ * Build on Linux:
+ *   g++ -O2 -I../../src txcmd.cpp ../../src/internal/TxCommand.cpp -o txcmd
+ *
+ * Usage:
+ *   txcmd <tty> [baud] [timeout msec]
+ *
+ * Reads one command per line from stdin:
+ *   <protocol index> <bit count> <code> [repeat count]
+ * The code may be decimal or hexadecimal with 0x prefix and may have up to
+ * 64 bits. Commands are sent without waiting for each response, as long as the
+ * transmitter reports free queue slots.
+ *
+ * A command, that has not been acknowledged within the timeout, is sent again
+ * with the same sequence number up to MAX_RETRIES times, followed by all later
+ * commands, that are still outstanding. The transmitter accepts the commands in
+ * the order of their sequence numbers only and doesn't queue a command twice. So
+ * the codes are sent once and in order. The exit code is 1, if a command finally
+ * failed.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "TxCommand.hpp"
+
+using namespace RcSwitchTx;
+
+namespace {
+
+constexpr long DEFAULT_TIMEOUT_MSEC = 1000;
+constexpr unsigned MAX_RETRIES = 3;
+
+long long nowMsec() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return 1000LL * ts.tv_sec + ts.tv_nsec / 1000000;
+}
+
+speed_t toSpeed(const long baud) {
+  switch (baud) {
+  case 9600: return B9600;
+  case 19200: return B19200;
+  case 38400: return B38400;
+  case 57600: return B57600;
+  case 230400: return B230400;
+  case 460800: return B460800;
+  case 921600: return B921600;
+  default: return B115200;
+  }
+}
+
+int openTty(const char* const path, const long baud) {
+  const int fd = open(path, O_RDWR | O_NOCTTY);
+  if (fd < 0) {
+    return fd;
+  }
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, toSpeed(baud));
+    cfsetospeed(&tio, toSpeed(baud));
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  return fd;
+}
+
+bool writeAll(const int fd, const uint8_t* buffer, size_t size) {
+  while (size) {
+    const ssize_t n = write(fd, buffer, size);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    buffer += n;
+    size -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+const char* statusText(const uint8_t status) {
+  switch (status) {
+  case TX_COMMAND_OK: return "ok";
+  case TX_COMMAND_BUSY: return "busy";
+  case TX_COMMAND_INIT_ERR: return "init error";
+  case TX_COMMAND_CRC_ERR: return "crc error";
+  case TX_COMMAND_INVALID: return "invalid";
+  case TX_COMMAND_SEQUENCE: return "out of sequence";
+  default: return "unknown";
+  }
+}
+
+class Client {
+  // A command, that has been sent, but not been acknowledged yet.
+  struct Pending {
+    bool active;
+    bool busy;          // Rejected, because the queue was full. Resending is not a retry.
+    unsigned retries;
+    long long deadline; // msec
+    size_t size;
+    uint8_t frame[TX_COMMAND_MAX_FRAME];
+  };
+
+  int mFd;
+  long mTimeoutMsec;
+  TxCommandDecoder mDecoder;
+  size_t mFreeSlots;  // Free queue slots reported by the last response.
+  size_t mInFlight;   // Commands sent, but not acknowledged yet.
+  size_t mFailures;   // Commands, that finally failed.
+  uint8_t mSeq;
+  Pending mPending[256]; // Indexed by sequence number
+
+  void complete(Pending& pending) {
+    pending.active = false;
+    mInFlight--;
+  }
+
+  void handleResponse(const TxCommandFrame& frame) {
+    if (frame.length < 2) {
+      return;
+    }
+    const uint8_t status = frame.payload[0];
+    mFreeSlots = frame.payload[1];
+    Pending& pending = mPending[frame.seq];
+    if (not pending.active) {
+      // A command, that failed to send after it had been queued, is responded
+      // a second time. A corrupted command is responded with the sequence number
+      // of the last valid one, which has mostly been acknowledged already.
+      if (frame.command != TX_COMMAND_ACK && status != TX_COMMAND_CRC_ERR
+          && status != TX_COMMAND_SEQUENCE) {
+        fprintf(stderr, "seq %u: %s\n", frame.seq, statusText(status));
+        mFailures++;
+      }
+      return;
+    }
+    if (frame.command == TX_COMMAND_ACK) {
+      complete(pending);
+      return;
+    }
+    switch (status) {
+    case TX_COMMAND_BUSY:
+      // Try again, when the transmitter had time to send queued codes.
+      pending.busy = true;
+      pending.deadline = nowMsec() + mTimeoutMsec;
+      break;
+    case TX_COMMAND_CRC_ERR:
+      // The sequence number of a corrupted command is unknown. It is resent on timeout.
+    case TX_COMMAND_SEQUENCE:
+      // A previous command got lost. It is resent on timeout together with this one.
+      break;
+    default:
+      fprintf(stderr, "seq %u: %s\n", frame.seq, statusText(status));
+      mFailures++;
+      complete(pending);
+      break;
+    }
+  }
+
+  // Resend the commands, that have not been acknowledged in time. The transmitter
+  // accepts commands in order only, so all later outstanding commands are resent
+  // as well, oldest first.
+  bool resendExpired() {
+    const long long now = nowMsec();
+    bool goBack = false;
+    for (unsigned age = sizeof(mPending) / sizeof(mPending[0]) - 1; age > 0; age--) {
+      const uint8_t seq = static_cast<uint8_t>(mSeq - age);
+      Pending& pending = mPending[seq];
+      if (not pending.active) {
+        continue;
+      }
+      if (now >= pending.deadline) {
+        if (pending.busy) {
+          pending.busy = false;
+        } else if (pending.retries < MAX_RETRIES) {
+          pending.retries++;
+        } else {
+          fprintf(stderr, "seq %u: no response\n", seq);
+          mFailures++;
+          complete(pending);
+          continue;
+        }
+        goBack = true;
+      } else if (not goBack) {
+        continue;
+      }
+      pending.deadline = now + mTimeoutMsec;
+      if (not writeAll(mFd, pending.frame, pending.size)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // The time until the next command times out.
+  int pollTimeout() const {
+    long long deadline = -1;
+    for (size_t seq = 0; seq < sizeof(mPending) / sizeof(mPending[0]); seq++) {
+      if (mPending[seq].active && (deadline < 0 || mPending[seq].deadline < deadline)) {
+        deadline = mPending[seq].deadline;
+      }
+    }
+    if (deadline < 0) {
+      return -1;
+    }
+    const long long timeout = deadline - nowMsec();
+    return timeout > 0 ? static_cast<int>(timeout) : 0;
+  }
+
+  // Process the responses, that arrive until the next command times out, and
+  // resend the timed out commands. Returns false on a read or write error.
+  bool service() {
+    struct pollfd pfd = {mFd, POLLIN, 0};
+    const int ready = poll(&pfd, 1, pollTimeout());
+    if (ready < 0 && errno != EINTR) {
+      return false;
+    }
+    if (ready > 0) {
+      uint8_t buffer[64];
+      const ssize_t n = read(mFd, buffer, sizeof(buffer));
+      if (n < 0 && errno != EINTR && errno != EAGAIN) {
+        return false;
+      }
+      if (n == 0) {
+        errno = EIO;
+        return false;
+      }
+      for (ssize_t i = 0; i < n; i++) {
+        const TxCommandDecoder::RESULT result = mDecoder.feed(buffer[i]);
+        if (result == TxCommandDecoder::COMPLETE) {
+          handleResponse(mDecoder.frame());
+        } else if (result == TxCommandDecoder::CRC_ERR) {
+          fprintf(stderr, "corrupted response\n");
+        }
+      }
+    }
+    return resendExpired();
+  }
+
+  bool transmit(const uint8_t seq, const uint8_t* const buffer, const size_t size) {
+    // Don't send more commands than the transmitter can queue.
+    while (mInFlight >= mFreeSlots && mInFlight) {
+      if (not service()) {
+        return false;
+      }
+    }
+    Pending& pending = mPending[seq];
+    pending.active = true;
+    pending.busy = false;
+    pending.retries = 0;
+    pending.deadline = nowMsec() + mTimeoutMsec;
+    pending.size = size;
+    memcpy(pending.frame, buffer, size);
+    mInFlight++;
+    return writeAll(mFd, buffer, size);
+  }
+
+public:
+  Client(const int fd, const long timeoutMsec) : mFd(fd), mTimeoutMsec(timeoutMsec), mDecoder(),
+    mFreeSlots(0), mInFlight(0), mFailures(0), mSeq(0), mPending() {}
+
+  bool ping() {
+    uint8_t buffer[TX_COMMAND_MAX_FRAME];
+    const uint8_t seq = mSeq++;
+    const size_t size = encodeTxCommand(buffer, sizeof(buffer), seq, TX_COMMAND_PING, nullptr, 0);
+    return transmit(seq, buffer, size) && drain();
+  }
+
+  bool send(const uint8_t protocolIndex, const uint8_t repeatCount, const uint32_t* const dwords,
+      const size_t bitCount) {
+    uint8_t buffer[TX_COMMAND_MAX_FRAME];
+    const uint8_t seq = mSeq++;
+    const size_t size = encodeTxSendCommand(buffer, sizeof(buffer), seq, protocolIndex,
+        repeatCount, dwords, bitCount);
+    if (size == 0) {
+      fprintf(stderr, "bit count out of range\n");
+      mFailures++;
+      return true;
+    }
+    return transmit(seq, buffer, size);
+  }
+
+  bool drain() {
+    while (mInFlight) {
+      if (not service()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  inline size_t failures() const {
+    return mFailures;
+  }
+};
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <tty> [baud] [timeout msec]\n", argv[0]);
+    return 2;
+  }
+  const long timeoutMsec = argc > 3 ? strtol(argv[3], nullptr, 10) : DEFAULT_TIMEOUT_MSEC;
+  const int fd = openTty(argv[1], argc > 2 ? strtol(argv[2], nullptr, 10) : 115200);
+  if (fd < 0) {
+    perror(argv[1]);
+    return 1;
+  }
+  Client client(fd, timeoutMsec > 0 ? timeoutMsec : DEFAULT_TIMEOUT_MSEC);
+  if (not client.ping()) {
+    perror("ping");
+    return 1;
+  }
+  if (client.failures()) {
+    return 1;
+  }
+  char line[128];
+  while (fgets(line, sizeof(line), stdin)) {
+    char* end;
+    const unsigned long protocolIndex = strtoul(line, &end, 0);
+    const unsigned long bitCount = strtoul(end, &end, 0);
+    const unsigned long long code = strtoull(end, &end, 0);
+    const unsigned long repeatCount = strtoul(end, &end, 0);
+    if (bitCount == 0) {
+      continue;
+    }
+    // Split the code into double words like the send() function expects them.
+    uint32_t dwords[TX_COMMAND_MAX_DWORDS] = {0};
+    if (bitCount > 32) {
+      dwords[0] = static_cast<uint32_t>(code >> (bitCount - 32));
+      dwords[1] = static_cast<uint32_t>(code);
+    } else {
+      dwords[0] = static_cast<uint32_t>(code);
+    }
+    if (not client.send(static_cast<uint8_t>(protocolIndex), static_cast<uint8_t>(repeatCount),
+        dwords, bitCount)) {
+      perror("send");
+      return 1;
+    }
+  }
+  if (not client.drain()) {
+    perror("receive");
+    return 1;
+  }
+  return client.failures() ? 1 : 0;
+}
@@ -0,0 +1,91 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/*
+ * Minimal Arduino API for running the library on the host. Pin writes and delays
+ * are recorded, time only advances by the delays. See TestStub.hpp.
+ */
+
+#pragma once
+
+#ifndef RCSWITCHTRANSMITTER_TEST_ARDUINO_H_
+#define RCSWITCHTRANSMITTER_TEST_ARDUINO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT  0x0
+#define OUTPUT 0x1
+
+#define CHANGE 1
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int level);
+int digitalRead(int pin);
+
+void delayMicroseconds(unsigned int usec);
+void delay(unsigned long msec);
+unsigned long micros();
+unsigned long millis();
+
+inline int digitalPinToInterrupt(const int pin) {return pin;}
+void attachInterrupt(int interruptNum, void (*isr)(), int mode);
+void detachInterrupt(int interruptNum);
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+class HardwareSerial {
+public:
+  void begin(unsigned long) {}
+  int available();
+  int read();
+  void flush() {}
+
+  size_t write(uint8_t c) {return write(&c, 1);}
+  size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* buffer, size_t size) {
+    return write(reinterpret_cast<const uint8_t*>(buffer), size);
+  }
+
+  size_t print(const char* s) {return write(s, strlen(s));}
+  size_t print(char c) {return write(static_cast<uint8_t>(c));}
+  size_t print(unsigned long value);
+  size_t print(long value);
+  size_t print(unsigned int value) {return print(static_cast<unsigned long>(value));}
+  size_t print(int value) {return print(static_cast<long>(value));}
+
+  size_t println() {return print("\r\n");}
+  template<typename T> size_t println(T value) {
+    const size_t n = print(value);
+    return n + println();
+  }
+};
+
+extern HardwareSerial Serial;
+
+#endif /* RCSWITCHTRANSMITTER_TEST_ARDUINO_H_ */
@@ -0,0 +1,208 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "TestStub.hpp"
+
+HardwareSerial Serial;
+int gTestFailures = 0;
+
+namespace {
+
+constexpr int PIN_COUNT = 64;
+
+std::vector<StubEvent> events;
+int levels[PIN_COUNT];
+int wiredTo[PIN_COUNT];   // rx pin -> tx pin, -1 if not wired
+void (*isrs[PIN_COUNT])();
+unsigned long now = 0;
+std::string serialOutput;
+int serialFd = -1;
+
+int levelOf(const int pin) {
+  return wiredTo[pin] >= 0 ? levels[wiredTo[pin]] : levels[pin];
+}
+
+} // anonymous name space
+
+void stubReset() {
+  events.clear();
+  serialOutput.clear();
+  for(int pin = 0; pin < PIN_COUNT; pin++) {
+    levels[pin] = LOW;
+    wiredTo[pin] = -1;
+    isrs[pin] = nullptr;
+  }
+}
+
+const std::vector<StubEvent>& stubEvents() {
+  return events;
+}
+
+std::vector<uint32_t> stubPulses() {
+  std::vector<uint32_t> pulses;
+  bool previousWasDelay = false;
+  for(size_t i = 0; i < events.size(); i++) {
+    if(events[i].kind == StubEvent::DELAY) {
+      if(previousWasDelay) {
+        pulses.back() += events[i].usec;
+      } else {
+        pulses.push_back(events[i].usec);
+      }
+    }
+    previousWasDelay = events[i].kind == StubEvent::DELAY;
+  }
+  return pulses;
+}
+
+void stubWire(const int txPin, const int rxPin) {
+  wiredTo[rxPin] = txPin;
+}
+
+void stubAdvance(const uint32_t usec) {
+  now += usec;
+}
+
+std::string& stubSerialOutput() {
+  return serialOutput;
+}
+
+void stubSerialAttach(const int fd) {
+  serialFd = fd;
+}
+
+namespace {
+
+// Start with a clean state without relying on the tests to call stubReset().
+struct StubInit {
+  StubInit() {
+    stubReset();
+  }
+} stubInit;
+
+} // anonymous name space
+
+int testResult(const char* name) {
+  printf("%s: %s (%d failures)\n", name, gTestFailures ? "FAILED" : "passed", gTestFailures);
+  return gTestFailures ? 1 : 0;
+}
+
+void pinMode(int, int) {
+}
+
+#if defined(STUB_NO_RECORDING)
+
+void digitalWrite(const int pin, const int level) {
+  levels[pin] = level;
+}
+
+void delayMicroseconds(const unsigned int usec) {
+  now += usec;
+}
+
+#else
+
+void digitalWrite(const int pin, const int level) {
+  events.push_back(StubEvent{StubEvent::WRITE, pin, level, 0});
+  const bool changed = levels[pin] != level;
+  levels[pin] = level;
+  if(changed) {
+    for(int rxPin = 0; rxPin < PIN_COUNT; rxPin++) {
+      if(isrs[rxPin] && (rxPin == pin || wiredTo[rxPin] == pin)) {
+        isrs[rxPin]();
+      }
+    }
+  }
+}
+
+void delayMicroseconds(const unsigned int usec) {
+  events.push_back(StubEvent{StubEvent::DELAY, -1, 0, usec});
+  now += usec;
+}
+
+#endif
+
+int digitalRead(const int pin) {
+  return levelOf(pin);
+}
+
+void delay(const unsigned long msec) {
+  now += 1000 * msec;
+}
+
+unsigned long micros() {
+  return now;
+}
+
+unsigned long millis() {
+  return now / 1000;
+}
+
+void attachInterrupt(const int interruptNum, void (*isr)(), int) {
+  isrs[interruptNum] = isr;
+}
+
+void detachInterrupt(const int interruptNum) {
+  isrs[interruptNum] = nullptr;
+}
+
+int HardwareSerial::available() {
+  int count = 0;
+  if(serialFd >= 0 && ioctl(serialFd, FIONREAD, &count) < 0) {
+    count = 0;
+  }
+  return count;
+}
+
+int HardwareSerial::read() {
+  uint8_t byte;
+  if(serialFd >= 0 && ::read(serialFd, &byte, 1) == 1) {
+    return byte;
+  }
+  return -1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, const size_t size) {
+  if(serialFd >= 0) {
+    const ssize_t written = ::write(serialFd, buffer, size);
+    return written > 0 ? static_cast<size_t>(written) : 0;
+  }
+  serialOutput.append(reinterpret_cast<const char*>(buffer), size);
+  return size;
+}
+
+size_t HardwareSerial::print(const unsigned long value) {
+  char buffer[24];
+  const int n = snprintf(buffer, sizeof(buffer), "%lu", value);
+  return write(buffer, static_cast<size_t>(n));
+}
+
+size_t HardwareSerial::print(const long value) {
+  char buffer[24];
+  const int n = snprintf(buffer, sizeof(buffer), "%ld", value);
+  return write(buffer, static_cast<size_t>(n));
+}
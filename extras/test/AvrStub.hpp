@@ -0,0 +1,73 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * Just enough of the AVR environment, to run the AVR branch of the static
+ * emitter on the host. The port register is a variable. Each delay loop is
+ * recorded with the level of the port at the time of the delay.
+ */
+
+#pragma once
+
+#ifndef RCSWITCHTRANSMITTER_TEST_AVR_STUB_HPP_
+#define RCSWITCHTRANSMITTER_TEST_AVR_STUB_HPP_
+
+#define __AVR__ 1
+#define F_CPU 16000000UL
+
+#include "TestStub.hpp"
+
+/** A recorded __builtin_avr_delay_cycles() call. */
+struct AvrDelay {
+  int level;        // Level of the pin during the delay.
+  uint32_t cycles;
+};
+
+static volatile uint8_t avrPort = 0;
+static volatile uint8_t avrSREG = 0x80; // Interrupts enabled
+static uint8_t avrPinMask = 0;
+static std::vector<AvrDelay> avrDelays;
+
+#define SREG avrSREG
+
+inline void cli() {
+  avrSREG &= static_cast<uint8_t>(~0x80);
+}
+
+inline uint8_t digitalPinToPort(const int) {return 0;}
+inline volatile uint8_t* portOutputRegister(const uint8_t) {return &avrPort;}
+inline uint8_t digitalPinToBitMask(const int pin) {
+  avrPinMask = static_cast<uint8_t>(1 << (pin & 7));
+  return avrPinMask;
+}
+
+inline void avrDelayCycles(const uint32_t cycles) {
+  const AvrDelay delay = {(avrPort & avrPinMask) ? HIGH : LOW, cycles};
+  avrDelays.push_back(delay);
+}
+
+#define __builtin_avr_delay_cycles(cycles) avrDelayCycles(cycles)
+
+#endif /* RCSWITCHTRANSMITTER_TEST_AVR_STUB_HPP_ */
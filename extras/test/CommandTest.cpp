@@ -0,0 +1,303 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * Runs the host tool txcmd against a TxCommandServer, that is connected to it by
+ * a pty. The frames are relayed by the test, so that single frames can be dropped
+ * or corrupted. Linux only.
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+#include "TxCommandServer.hpp"
+
+namespace {
+
+const TxProtocolTable<
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>
+> txProtocolTable;
+
+constexpr int TX_PIN = 5;
+constexpr const char* TIMEOUT_MSEC = "200";
+
+RcSwitchTransmitter<TX_PIN> transmitter;
+TxCommandServer<TX_PIN> server(transmitter, Serial);
+
+int openPty() {
+  const int fd = posix_openpt(O_RDWR | O_NOCTTY);
+  if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0) {
+    return -1;
+  }
+  struct termios tio;
+  tcgetattr(fd, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(fd, TCSANOW, &tio);
+  return fd;
+}
+
+// Start txcmd on the slave side of the pty. The commands are written to its stdin.
+pid_t startClient(const int pty, const std::string& commands) {
+  int pipeFds[2];
+  if (pipe(pipeFds) != 0) {
+    return -1;
+  }
+  const std::string ttyName = ptsname(pty);
+  const pid_t pid = fork();
+  if (pid == 0) {
+    dup2(pipeFds[0], STDIN_FILENO);
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+    close(pty);
+    execl("./txcmd", "txcmd", ttyName.c_str(), "115200", TIMEOUT_MSEC, static_cast<char*>(nullptr));
+    _exit(127);
+  }
+  close(pipeFds[0]);
+  TEST_CHECK(write(pipeFds[1], commands.data(), commands.size()) == static_cast<ssize_t>(commands.size()));
+  close(pipeFds[1]);
+  return pid;
+}
+
+// The exit code of the client, or -1 if it is still running.
+int clientExitCode(const pid_t pid) {
+  int status;
+  if (waitpid(pid, &status, WNOHANG) != pid) {
+    return -1;
+  }
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+}
+
+// A fault, that is applied once to the first frame with the given command and SEQ.
+struct Fault {
+  enum ACTION {DROP, CORRUPT} action;
+  uint8_t command;
+  uint8_t seq;
+  bool applied;
+};
+
+/**
+ * Forwards the frames in one direction and applies the faults.
+ */
+class Link {
+  const int mFrom;
+  const int mTo;
+  RcSwitchTx::TxCommandDecoder mDecoder;
+  std::vector<uint8_t> mFrame;
+  std::vector<Fault> mFaults;
+  std::vector<RcSwitchTx::TxCommandFrame> mFrames; // All forwarded or faulted frames
+
+  void forward() {
+    TEST_CHECK(write(mTo, mFrame.data(), mFrame.size()) == static_cast<ssize_t>(mFrame.size()));
+    mFrame.clear();
+  }
+
+  void handleFrame(const RcSwitchTx::TxCommandFrame& frame) {
+    mFrames.push_back(frame);
+    for (size_t i = 0; i < mFaults.size(); i++) {
+      Fault& fault = mFaults[i];
+      if (not fault.applied && fault.command == frame.command && fault.seq == frame.seq) {
+        fault.applied = true;
+        if (fault.action == Fault::DROP) {
+          mFrame.clear();
+          return;
+        }
+        // Flip a bit of the byte in front of the CRC.
+        mFrame[mFrame.size() - 2] ^= 0x01;
+      }
+    }
+    forward();
+  }
+
+public:
+  Link(const int from, const int to, const std::vector<Fault>& faults)
+    : mFrom(from), mTo(to), mDecoder(), mFrame(), mFaults(faults), mFrames() {
+  }
+
+  void pump() {
+    struct pollfd pfd = {mFrom, POLLIN, 0};
+    while (poll(&pfd, 1, 0) > 0 && (pfd.revents & POLLIN)) {
+      uint8_t buffer[64];
+      const ssize_t n = read(mFrom, buffer, sizeof(buffer));
+      if (n <= 0) {
+        return;
+      }
+      for (ssize_t i = 0; i < n; i++) {
+        mFrame.push_back(buffer[i]);
+        switch (mDecoder.feed(buffer[i])) {
+        case RcSwitchTx::TxCommandDecoder::COMPLETE:
+          handleFrame(mDecoder.frame());
+          break;
+        case RcSwitchTx::TxCommandDecoder::CRC_ERR:
+          forward();
+          break;
+        case RcSwitchTx::TxCommandDecoder::PENDING:
+          break;
+        }
+      }
+    }
+  }
+
+  bool allFaultsApplied() const {
+    for (size_t i = 0; i < mFaults.size(); i++) {
+      if (not mFaults[i].applied) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  size_t frameCount(const uint8_t command, const uint8_t seq) const {
+    size_t count = 0;
+    for (size_t i = 0; i < mFrames.size(); i++) {
+      count += mFrames[i].command == command && mFrames[i].seq == seq ? 1 : 0;
+    }
+    return count;
+  }
+};
+
+// The code of a frame with 24 bits and a repeat count of 1.
+bool decodeFrame(const std::vector<uint32_t>& pulses, uint32_t& code) {
+  if (pulses.size() != 2 + 2 * 24 + 2) {
+    return false;
+  }
+  code = 0;
+  for (size_t i = 0; i < 24; i++) {
+    code = (code << 1) | (pulses[2 + 2 * i] == 3 * 350 ? 1 : 0);
+  }
+  return true;
+}
+
+// Serve the client until it exits and all queued codes have been sent. Returns
+// the exit code of the client.
+int serve(const pid_t pid, Link& toServer, Link& toClient, std::vector<uint32_t>& codes,
+    size_t& maxQueued) {
+  int exitCode = -1;
+  for (int i = 0; i < 100000; i++) {
+    if (exitCode < 0) {
+      exitCode = clientExitCode(pid);
+    }
+    if (exitCode >= 0 && server.freeSlots() == RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE) {
+      return exitCode;
+    }
+    stubReset();
+    toServer.pump();
+    server.handle();
+    toClient.pump();
+    const size_t queued = RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE - server.freeSlots();
+    maxQueued = queued > maxQueued ? queued : maxQueued;
+    if (stubEvents().empty()) {
+      usleep(100);
+    } else {
+      uint32_t code;
+      TEST_CHECK(decodeFrame(stubPulses(), code));
+      codes.push_back(code);
+      // Let the queue fill up, like it does while a frame is being sent.
+      usleep(2000);
+    }
+  }
+  if (exitCode < 0) {
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+  }
+  return -1;
+}
+
+} // anonymous name space
+
+int main() {
+  transmitter.begin(txProtocolTable.toTimingSpecTable());
+
+  // All codes are sent once and in order, although the ping, an acknowledge and
+  // a send command are lost, and a send command is corrupted.
+  {
+    const int pty = openPty();
+    TEST_CHECK(pty >= 0);
+    int serial[2];
+    TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, serial) == 0);
+    stubSerialAttach(serial[1]);
+    Link toServer(pty, serial[0], {
+      Fault{Fault::DROP, RcSwitchTx::TX_COMMAND_PING, 0, false},
+      Fault{Fault::DROP, RcSwitchTx::TX_COMMAND_SEND, 10, false},
+      Fault{Fault::CORRUPT, RcSwitchTx::TX_COMMAND_SEND, 20, false},
+    });
+    Link toClient(serial[0], pty, {
+      Fault{Fault::DROP, RcSwitchTx::TX_COMMAND_ACK, 5, false},
+    });
+    std::string commands;
+    std::vector<uint32_t> expected;
+    for (uint32_t code = 0x100000; code < 0x100000 + 40; code++) {
+      char line[32];
+      snprintf(line, sizeof(line), "0 24 0x%x 1\n", static_cast<unsigned>(code));
+      commands += line;
+      expected.push_back(code);
+    }
+    const pid_t pid = startClient(pty, commands);
+    TEST_CHECK(pid > 0);
+    std::vector<uint32_t> codes;
+    size_t maxQueued = 0;
+    TEST_CHECK(serve(pid, toServer, toClient, codes, maxQueued) == 0);
+    TEST_CHECK(codes == expected);
+    TEST_CHECK(maxQueued > 1);
+    TEST_CHECK(toServer.allFaultsApplied() && toClient.allFaultsApplied());
+    // The command, whose acknowledge got lost, has been resent and acknowledged again.
+    TEST_CHECK(toServer.frameCount(RcSwitchTx::TX_COMMAND_SEND, 5) > 1);
+    TEST_CHECK(toClient.frameCount(RcSwitchTx::TX_COMMAND_ACK, 5) > 1);
+    // The repeat count of the commands doesn't change the one of the transmitter.
+    TEST_CHECK(transmitter.repeatCount() == RcSwitchTransmitter<TX_PIN>::DEFAULT_REPEAT_CNT);
+    stubSerialAttach(-1);
+    close(serial[0]);
+    close(serial[1]);
+    close(pty);
+  }
+
+  // The client gives up, if the transmitter doesn't respond at all.
+  {
+    const int pty = openPty();
+    TEST_CHECK(pty >= 0);
+    const pid_t pid = startClient(pty, "0 24 0x123456 1\n");
+    TEST_CHECK(pid > 0);
+    int exitCode = -1;
+    for (int i = 0; i < 500 && exitCode < 0; i++) {
+      usleep(10000);
+      exitCode = clientExitCode(pid);
+    }
+    if (exitCode < 0) {
+      kill(pid, SIGKILL);
+      waitpid(pid, nullptr, 0);
+    }
+    TEST_CHECK(exitCode == 1);
+    close(pty);
+  }
+
+  return testResult("CommandTest");
+}
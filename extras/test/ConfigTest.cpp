@@ -0,0 +1,60 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * A sketch, that is linked against library objects built with the default
+ * configuration. The Makefile builds it once with the same configuration, which
+ * must link and run, and once per mismatching configuration, which must fail to
+ * link.
+ */
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+#include "TxCommandServer.hpp"
+
+namespace {
+
+const TxProtocolTable<
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>
+> txProtocolTable;
+
+constexpr int TX_PIN = 5;
+
+} // anonymous name space
+
+int main() {
+  static RcSwitchTransmitter<TX_PIN> transmitter;
+  static TxCommandServer<TX_PIN> server(transmitter, Serial);
+  transmitter.begin(txProtocolTable.toTimingSpecTable());
+  server.handle();
+
+  stubReset();
+  transmitter.setRepeatCount(1);
+  TEST_CHECK(transmitter.send(0, 0x5, 4) == RcSwitchTx::OK);
+  TEST_CHECK(stubPulses().size() == 2 + 2 * 4 + 2);
+  TEST_CHECK(stubPulses().front() == 350);
+
+  return testResult("ConfigTest");
+}
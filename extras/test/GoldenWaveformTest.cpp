@@ -0,0 +1,280 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/*
+ * Compares the recorded pin writes and delays of send() and sendBurst() with the
+ * waveform, that is computed independently from the protocol definitions of the
+ * Simple example.
+ */
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+
+namespace {
+
+// The rows of examples/Simple/Simple.ino.
+#define PROTOCOL_ROWS(ROW, LAST_ROW) \
+  ROW(350,  1,   31,    1,  3,    3,  1, false) \
+  ROW(650,  1,   10,    1,  3,    3,  1, false) \
+  ROW(100, 30,   71,    4, 11,    9,  6, false) \
+  ROW(380,  1,    6,    1,  3,    3,  1, false) \
+  ROW(500,  6,   14,    1,  2,    2,  1, false) \
+  ROW(450,  1,   23,    1,  2,    2,  1, true)  \
+  ROW(150,  2,   62,    1,  6,    6,  1, false) \
+  ROW(200,  3,  130,    7, 16,    3, 16, false) \
+  ROW(365,  1,   18,    3,  1,    1,  3, true)  \
+  ROW(270,  1,   36,    1,  2,    2,  1, true)  \
+  ROW(320,  1,   36,    1,  2,    2,  1, true)  \
+  LAST_ROW(300, 2, 23,  2,  4,    4,  2, false)
+
+#define TABLE_ROW(...) makeTxTimingSpec<__VA_ARGS__>,
+#define TABLE_LAST_ROW(...) makeTxTimingSpec<__VA_ARGS__>
+const TxProtocolTable<PROTOCOL_ROWS(TABLE_ROW, TABLE_LAST_ROW)> txProtocolTable;
+
+struct Protocol {
+  unsigned clock;
+  unsigned synchA, synchB, data0A, data0B, data1A, data1B;
+  bool inverseLevel;
+};
+
+#define PROTOCOL_ROW(clk, sA, sB, d0A, d0B, d1A, d1B, inv) {clk, sA, sB, d0A, d0B, d1A, d1B, inv},
+const Protocol protocols[] = {PROTOCOL_ROWS(PROTOCOL_ROW, PROTOCOL_ROW)};
+
+constexpr int TX_PIN = 7;
+
+struct Pulse {
+  int level;
+  uint32_t usec;
+};
+
+void appendPair(std::vector<Pulse>& pulses, const Protocol& p, const unsigned a, const unsigned b) {
+  pulses.push_back(Pulse{p.inverseLevel ? LOW : HIGH, p.clock * a});
+  pulses.push_back(Pulse{p.inverseLevel ? HIGH : LOW, p.clock * b});
+}
+
+// The bit at position i of the frame. Full double words come first, the last one
+// contributes its low significant bits only.
+bool frameBit(const uint32_t* dwords, const size_t bitCount, const size_t i) {
+  const size_t index = i / 32;
+  const size_t bitsInDword = (index + 1) * 32 <= bitCount ? 32 : bitCount % 32;
+  return (dwords[index] >> (bitsInDword - 1 - i % 32)) & 1;
+}
+
+void appendSynch(std::vector<Pulse>& pulses, const Protocol& p) {
+  appendPair(pulses, p, p.synchA, p.synchB);
+}
+
+void appendBits(std::vector<Pulse>& pulses, const Protocol& p, const uint32_t* dwords,
+    const size_t bitCount) {
+  for(size_t i = 0; i < bitCount; i++) {
+    if(frameBit(dwords, bitCount, i)) {
+      appendPair(pulses, p, p.data1A, p.data1B);
+    } else {
+      appendPair(pulses, p, p.data0A, p.data0B);
+    }
+  }
+}
+
+std::vector<Pulse> expectedFrame(const Protocol& p, const uint32_t* dwords, const size_t bitCount,
+    const size_t repeatCount) {
+  std::vector<Pulse> pulses;
+  appendSynch(pulses, p);
+  for(size_t repeat = 0; repeat < repeatCount; repeat++) {
+    appendBits(pulses, p, dwords, bitCount);
+    appendSynch(pulses, p);
+  }
+  return pulses;
+}
+
+// The repetitions of the entries are interleaved. Consecutive frames of the same
+// protocol share the synch between them.
+std::vector<Pulse> expectedBurst(const RcSwitchTx::TxBurstEntry* entries, const size_t entryCount,
+    const size_t repeatCount) {
+  std::vector<Pulse> pulses;
+  const Protocol* previous = nullptr;
+  for(size_t repeat = 0; repeat < repeatCount; repeat++) {
+    for(size_t i = 0; i < entryCount; i++) {
+      const Protocol& p = protocols[entries[i].protocolIndex];
+      if(&p != previous) {
+        appendSynch(pulses, p);
+      }
+      appendBits(pulses, p, &entries[i].code, entries[i].bitCount);
+      appendSynch(pulses, p);
+      previous = &p;
+    }
+  }
+  return pulses;
+}
+
+// Each pulse is a write of its level followed by one or more delays.
+std::vector<Pulse> recordedFrame() {
+  std::vector<Pulse> pulses;
+  const std::vector<StubEvent>& events = stubEvents();
+  for(size_t i = 0; i < events.size(); i++) {
+    if(events[i].kind == StubEvent::WRITE) {
+      TEST_CHECK(events[i].pin == TX_PIN);
+      pulses.push_back(Pulse{events[i].level, 0});
+    } else if(not pulses.empty()) {
+      pulses.back().usec += events[i].usec;
+    }
+  }
+  return pulses;
+}
+
+bool sameFrame(const std::vector<Pulse>& a, const std::vector<Pulse>& b) {
+  if(a.size() != b.size()) {
+    return false;
+  }
+  for(size_t i = 0; i < a.size(); i++) {
+    if(a[i].level != b[i].level || a[i].usec != b[i].usec) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void checkFrame(RcSwitchTransmitter<TX_PIN>& transmitter, const size_t protocolIndex,
+    const uint32_t* dwords, const size_t bitCount, const size_t repeatCount) {
+  transmitter.setRepeatCount(repeatCount);
+  stubReset();
+  TEST_CHECK(transmitter.send(protocolIndex, dwords, bitCount) == RcSwitchTx::OK);
+  const bool same = sameFrame(recordedFrame(),
+      expectedFrame(protocols[protocolIndex], dwords, bitCount, repeatCount));
+  if(not same) {
+    fprintf(stderr, "protocol %zu, %zu bits, %zu repeats differs\n", protocolIndex, bitCount, repeatCount);
+  }
+  TEST_CHECK(same);
+}
+
+template<size_t N>
+void checkBurst(RcSwitchTransmitter<TX_PIN>& transmitter, const RcSwitchTx::TxBurstEntry (&entries)[N],
+    const size_t repeatCount) {
+  transmitter.setRepeatCount(repeatCount);
+  stubReset();
+  TEST_CHECK(transmitter.sendBurst(entries) == RcSwitchTx::OK);
+  const bool same = sameFrame(recordedFrame(), expectedBurst(entries, N, repeatCount));
+  if(not same) {
+    fprintf(stderr, "burst of %zu entries, %zu repeats differs\n", N, repeatCount);
+  }
+  TEST_CHECK(same);
+}
+
+void checkBursts(RcSwitchTransmitter<TX_PIN>& transmitter) {
+  // Mixed protocols, among them an inverse one, a 1 bit and a 32 bit code, and runs
+  // of the same protocol.
+  const RcSwitchTx::TxBurstEntry mixed[] = {
+    {0, 0x123456, 24}, {0, 0xABCDEF, 24}, {5, 0x5A5, 12}, {2, 0x1, 1}, {2, 0x80000001, 32}, {0, 0x3, 2},
+  };
+  for(size_t repeatCount = 1; repeatCount <= 3; repeatCount++) {
+    checkBurst(transmitter, mixed, repeatCount);
+  }
+
+  // Spelled out: 2 protocols are interleaved per repetition. Each frame has its
+  // own synchs, because the protocol changes from frame to frame.
+  const RcSwitchTx::TxBurstEntry alternating[] = {{0, 0x1, 1}, {5, 0x0, 1}};
+  const Protocol& p0 = protocols[0];
+  const Protocol& p5 = protocols[5];
+  std::vector<Pulse> expected;
+  for(size_t repeat = 0; repeat < 2; repeat++) {
+    appendPair(expected, p0, p0.synchA, p0.synchB);
+    appendPair(expected, p0, p0.data1A, p0.data1B);
+    appendPair(expected, p0, p0.synchA, p0.synchB);
+    appendPair(expected, p5, p5.synchA, p5.synchB);
+    appendPair(expected, p5, p5.data0A, p5.data0B);
+    appendPair(expected, p5, p5.synchA, p5.synchB);
+  }
+  transmitter.setRepeatCount(2);
+  stubReset();
+  TEST_CHECK(transmitter.sendBurst(alternating) == RcSwitchTx::OK);
+  TEST_CHECK(sameFrame(recordedFrame(), expected));
+
+  // Spelled out: frames of the same protocol share the synch between them, also
+  // from one repetition to the next.
+  const RcSwitchTx::TxBurstEntry shared[] = {{0, 0x1, 1}, {0, 0x0, 1}};
+  expected.clear();
+  appendPair(expected, p0, p0.synchA, p0.synchB);
+  for(size_t repeat = 0; repeat < 2; repeat++) {
+    appendPair(expected, p0, p0.data1A, p0.data1B);
+    appendPair(expected, p0, p0.synchA, p0.synchB);
+    appendPair(expected, p0, p0.data0A, p0.data0B);
+    appendPair(expected, p0, p0.synchA, p0.synchB);
+  }
+  stubReset();
+  TEST_CHECK(transmitter.sendBurst(shared) == RcSwitchTx::OK);
+  TEST_CHECK(sameFrame(recordedFrame(), expected));
+
+  // A bad entry anywhere rejects the whole burst without any pin activity.
+  const RcSwitchTx::TxBurstEntry badIndex[] = {{0, 0x1, 24}, {txProtocolTable.ROW_COUNT, 0x1, 24}};
+  stubReset();
+  TEST_CHECK(transmitter.sendBurst(badIndex) == RcSwitchTx::INIT_ERR);
+  TEST_CHECK(stubEvents().empty());
+
+  const RcSwitchTx::TxBurstEntry tooManyBits[] = {{0, 0x1, 24}, {2, 0x1, 33}};
+  stubReset();
+  TEST_CHECK(transmitter.sendBurst(tooManyBits) == RcSwitchTx::INIT_ERR);
+  TEST_CHECK(stubEvents().empty());
+
+  // Without begin(), a burst is rejected as well.
+  static RcSwitchTransmitter<TX_PIN + 1> notStarted;
+  stubReset();
+  TEST_CHECK(notStarted.sendBurst(mixed) == RcSwitchTx::INIT_ERR);
+  TEST_CHECK(stubEvents().empty());
+}
+
+} // anonymous name space
+
+int main() {
+  static RcSwitchTransmitter<TX_PIN> transmitter;
+  transmitter.begin(txProtocolTable.toTimingSpecTable());
+
+  // Bit 31 and bit 0 set in every double word, partial last double words.
+  const uint32_t dwords[] = {0x80000001, 0xC0000003, 0xA5A5A5A5};
+  const size_t bitCounts[] = {1, 23, 24, 31, 32, 33, 64, 70};
+  const size_t repeatCounts[] = {1, 3, 5};
+
+  for(size_t protocolIndex = 0; protocolIndex < txProtocolTable.ROW_COUNT; protocolIndex++) {
+    for(size_t b = 0; b < sizeof(bitCounts) / sizeof(bitCounts[0]); b++) {
+      for(size_t r = 0; r < sizeof(repeatCounts) / sizeof(repeatCounts[0]); r++) {
+        checkFrame(transmitter, protocolIndex, dwords, bitCounts[b], repeatCounts[r]);
+      }
+    }
+  }
+
+  // A single 32 bit code with bit 31 set.
+  transmitter.setRepeatCount(1);
+  stubReset();
+  transmitter.send(0, 0x80000000, 32);
+  const std::vector<Pulse> frame = recordedFrame();
+  TEST_CHECK(frame.size() == 2 + 2 * 32 + 2);
+  TEST_CHECK(frame.size() > 3 && frame[2].usec == 3 * 350 && frame[3].usec == 1 * 350);
+
+  // An invalid protocol index is rejected without any pin activity.
+  stubReset();
+  TEST_CHECK(transmitter.send(txProtocolTable.ROW_COUNT, dwords, 24) == RcSwitchTx::INIT_ERR);
+  TEST_CHECK(stubEvents().empty());
+
+  checkBursts(transmitter);
+
+  return testResult("GoldenWaveformTest");
+}
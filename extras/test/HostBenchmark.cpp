@@ -0,0 +1,151 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/*
+ * Runs the benchmarks of examples/Benchmark on the host against the stub Arduino
+ * API and prints the results in the same CSV format:
+ *
+ *   benchmark,parameter,iterations,usec,metric,value
+ *
+ * The benchmark is built with STUB_NO_RECORDING, so pin writes and delays are
+ * no-ops, that don't wait. The send benchmarks thus measure the CPU time of the
+ * encoder per pulse pair instead of the overhead on a pulse: the encoded bits per
+ * second and, on x86, the time stamp counter cycles per pulse pair.
+ */
+
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_BENCHMARK_CYCLES() __rdtsc()
+#endif
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+#include "Whitening.hpp"
+
+namespace {
+
+const TxProtocolTable <
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>,
+  makeTxTimingSpec<100, 30,   71,    4, 11,    9,  6, false>,
+  makeTxTimingSpec<450,  1,   23,    1,  2,    2,  1, true>
+> txProtocolTable;
+
+constexpr int TX_PIN = 7;
+constexpr size_t REPEAT_CNT = 3;
+
+RcSwitchTransmitter<TX_PIN> rcSwitchTransmitter;
+
+typedef std::chrono::steady_clock bench_clock_t;
+
+uint64_t elapsedNsec(const bench_clock_t::time_point start) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(bench_clock_t::now() - start).count());
+}
+
+void printResult(const char* benchmark, const unsigned long parameter, const unsigned long iterations,
+    const uint64_t nsec, const char* metric, const long long value) {
+  printf("%s,%lu,%lu,%llu,%s,%lld\n", benchmark, parameter, iterations,
+      static_cast<unsigned long long>(nsec / 1000), metric, value);
+}
+
+void benchmarkSend(const size_t protocolIndex, const uint32_t code, const size_t bitCount,
+    const bool sendStatic) {
+  constexpr unsigned long ITERATIONS = 2000;
+  const uint64_t pulsePairCount = 1 + REPEAT_CNT * (bitCount + 1);
+  const char* const benchmark = sendStatic ? "send_static" : "send";
+
+#if defined(HOST_BENCHMARK_CYCLES)
+  const uint64_t startCycles = HOST_BENCHMARK_CYCLES();
+#endif
+  const bench_clock_t::time_point start = bench_clock_t::now();
+  for(unsigned long i = 0; i < ITERATIONS; i++) {
+    if(sendStatic) {
+      rcSwitchTransmitter.sendStatic(txProtocolTable, protocolIndex, code, bitCount);
+    } else {
+      rcSwitchTransmitter.send(protocolIndex, code, bitCount);
+    }
+  }
+  const uint64_t nsec = elapsedNsec(start);
+#if defined(HOST_BENCHMARK_CYCLES)
+  const uint64_t cycles = HOST_BENCHMARK_CYCLES() - startCycles;
+#endif
+
+  printResult(benchmark, protocolIndex, ITERATIONS, nsec, "bits_per_sec",
+      static_cast<long long>((1000000000ULL * bitCount * REPEAT_CNT * ITERATIONS) / (nsec ? nsec : 1)));
+  printResult(benchmark, protocolIndex, ITERATIONS, nsec, "host_nsec_per_pulse_pair",
+      static_cast<long long>(nsec / (ITERATIONS * pulsePairCount)));
+#if defined(HOST_BENCHMARK_CYCLES)
+  printResult(benchmark, protocolIndex, ITERATIONS, nsec, "host_cycles_per_pulse_pair",
+      static_cast<long long>(cycles / (ITERATIONS * pulsePairCount)));
+#endif
+}
+
+void benchmarkWhitening(const size_t byteCount) {
+  constexpr unsigned long ITERATIONS = 100000;
+  static uint8_t buffer[64];
+  for(size_t i = 0; i < byteCount; i++) {
+    buffer[i] = static_cast<uint8_t>(i);
+  }
+
+  const bench_clock_t::time_point start = bench_clock_t::now();
+  for(unsigned long i = 0; i < ITERATIONS; i++) {
+    RcSwitchTx::computeWhitening(buffer, 8 * byteCount);
+  }
+  const uint64_t nsec = elapsedNsec(start);
+  printResult("whitening", byteCount, ITERATIONS, nsec, "bits_per_sec",
+      static_cast<long long>((1000000000ULL * 8 * byteCount * ITERATIONS) / (nsec ? nsec : 1)));
+}
+
+void benchmarkDump() {
+  constexpr unsigned long ITERATIONS = 10000;
+  const bench_clock_t::time_point start = bench_clock_t::now();
+  for(unsigned long i = 0; i < ITERATIONS; i++) {
+    stubSerialOutput().clear();
+    txProtocolTable.dumpTimingSpec(Serial);
+  }
+  const uint64_t nsec = elapsedNsec(start);
+  printResult("dump", txProtocolTable.ROW_COUNT, ITERATIONS, nsec, "nsec_per_row",
+      static_cast<long long>(nsec / (ITERATIONS * txProtocolTable.ROW_COUNT)));
+}
+
+} // anonymous name space
+
+int main() {
+  rcSwitchTransmitter.begin(txProtocolTable.toTimingSpecTable());
+  rcSwitchTransmitter.setRepeatCount(REPEAT_CNT);
+
+  printf("benchmark,parameter,iterations,usec,metric,value\n");
+  benchmarkDump();
+  for(size_t protocolIndex = 0; protocolIndex < txProtocolTable.ROW_COUNT; protocolIndex++) {
+    benchmarkSend(protocolIndex, 0x55AA55, 24, false);
+    benchmarkSend(protocolIndex, 0x55AA55, 24, true);
+  }
+  const size_t byteCounts[] = {1, 4, 16, 64};
+  for(size_t i = 0; i < sizeof(byteCounts) / sizeof(byteCounts[0]); i++) {
+    benchmarkWhitening(byteCounts[i]);
+  }
+  return 0;
+}
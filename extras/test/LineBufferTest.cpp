@@ -0,0 +1,61 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * Checks, that TxLineBuffer cuts off overlong text, but always terminates the line.
+ */
+
+#include "TestStub.hpp"
+#include "internal/TxFormattedPrint.hpp"
+
+using RcSwitchTx::TxLineBuffer;
+
+int main() {
+  // A short line
+  TxLineBuffer line;
+  line.put("pulses=").putDecimal(42).put(' ').putDecimal64(12345678901ULL);
+  line.writeLine(Serial);
+  TEST_CHECK(stubSerialOutput() == "pulses=42 12345678901\r\n");
+
+  // A line, that fills the capacity exactly.
+  stubReset();
+  const std::string full(TxLineBuffer::CAPACITY, 'x');
+  line.put(full.c_str());
+  line.writeLine(Serial);
+  TEST_CHECK(stubSerialOutput() == full + "\r\n");
+
+  // Overlong text is cut off, but the line break is kept.
+  stubReset();
+  line.put(full.c_str()).put("overflow").putDecimal(123);
+  line.writeLine(Serial);
+  TEST_CHECK(stubSerialOutput() == full + "\r\n");
+
+  // The buffer is empty after writing.
+  stubReset();
+  line.writeLine(Serial);
+  TEST_CHECK(stubSerialOutput() == "\r\n");
+
+  return testResult("LineBufferTest");
+}
@@ -0,0 +1,126 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * Checks the loopback verification with the receive pin wired to the transmit
+ * pin. Built with RCSWITCH_TRANSMITTER_LOOPBACK_CAPACITY=160 like on AVR.
+ */
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+#include "TxLoopback.hpp"
+
+namespace {
+
+const TxProtocolTable<
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>,
+  makeTxTimingSpec<450,  1,   23,    1,  2,    2,  1, true>,
+  makeTxTimingSpec<100, 30,   71,    4, 11,    9,  6, false>,
+  // Protocol 0 with a 10 usec longer base time.
+  makeTxTimingSpec<360,  1,   31,    1,  3,    3,  1, false>
+> txProtocolTable;
+
+constexpr int TX_PIN = 7;
+constexpr int RX_PIN = 2;
+constexpr int UNWIRED_PIN = 3;
+
+RcSwitchTransmitter<TX_PIN> transmitter;
+RcSwitchTx::TxLoopback loopback;
+
+RcSwitchTx::TxLoopbackReport send(const size_t protocolIndex, const uint32_t code,
+    const size_t bitCount) {
+  RcSwitchTx::TxLoopbackReport report;
+  TEST_CHECK(transmitter.send(protocolIndex, code, bitCount, loopback, report) == RcSwitchTx::OK);
+  return report;
+}
+
+void checkNoErrors(const RcSwitchTx::TxLoopbackReport& report) {
+  TEST_CHECK(report.pulseCount > 0);
+  TEST_CHECK(report.bitErrors == 0);
+  TEST_CHECK(report.synchErrors == 0);
+  TEST_CHECK(report.maxDeviation == 0);
+  TEST_CHECK(not report.truncated);
+}
+
+} // anonymous name space
+
+int main() {
+  stubWire(TX_PIN, RX_PIN);
+  transmitter.begin(txProtocolTable.toTimingSpecTable());
+  transmitter.setRepeatCount(1);
+  loopback.begin(RX_PIN);
+
+  // The pin is low, so the first pulse of a normal frame starts with an edge.
+  checkNoErrors(send(0, 0x5, 4));
+
+  // The pin is low, so the first pulse of an inverse frame has no leading edge.
+  digitalWrite(TX_PIN, LOW);
+  checkNoErrors(send(1, 0x5, 4));
+
+  // Alternate between the levels.
+  checkNoErrors(send(0, 0xA, 4));
+  checkNoErrors(send(1, 0xA, 4));
+  checkNoErrors(send(1, 0x3, 4));
+  checkNoErrors(send(0, 0x3, 4));
+
+  // The default frame fits completely: a leading synch and 3 repeats of 24 bits and
+  // a synch. Only the very last pulse has no terminating edge.
+  transmitter.setRepeatCount(3);
+  digitalWrite(TX_PIN, LOW);
+  RcSwitchTx::TxLoopbackReport report = send(0, 0xA5A5A5, 24);
+  checkNoErrors(report);
+  TEST_CHECK(report.pulseCount == 2 * (1 + 3 * (24 + 1)) - 1);
+
+  // A frame with more pulses than can be captured. The first captured duration
+  // is the idle time before the first edge.
+  digitalWrite(TX_PIN, LOW);
+  report = send(0, 0xA5A5A5A5, 32);
+  TEST_CHECK(report.truncated);
+  TEST_CHECK(report.bitErrors == 0);
+  TEST_CHECK(report.synchErrors == 0);
+  TEST_CHECK(report.pulseCount == RCSWITCH_TRANSMITTER_LOOPBACK_CAPACITY - 1);
+
+  // Verifying against a slightly slower timing stays within the tolerance, but
+  // reports the deviation of the longest pulse: the synch low time of 31 * 10 usec.
+  transmitter.setRepeatCount(1);
+  send(0, 0x5, 4);
+  const uint32_t code = 0x5;
+  TEST_CHECK(loopback.verify(txProtocolTable.toTimingSpecTable().start[3], &code, 4, 1, report));
+  TEST_CHECK(report.bitErrors == 0);
+  TEST_CHECK(report.synchErrors == 0);
+  TEST_CHECK(report.maxDeviation == 310);
+
+  // Verifying against another protocol yields errors.
+  TEST_CHECK(loopback.verify(txProtocolTable.toTimingSpecTable().start[2], &code, 4, 1, report));
+  TEST_CHECK(report.bitErrors + report.synchErrors > 0);
+
+  // A receive pin without connection to the data line doesn't capture anything.
+  RcSwitchTx::TxLoopback unwired;
+  unwired.begin(UNWIRED_PIN);
+  TEST_CHECK(transmitter.send(0, 0x5, 4, unwired, report) == RcSwitchTx::LOOPBACK_ERR);
+  TEST_CHECK(report.pulseCount == 0);
+
+  return testResult("LoopbackTest");
+}
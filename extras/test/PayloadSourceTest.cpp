@@ -0,0 +1,245 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * Checks the payload sources against the published check values of the CRCs for
+ * "123456789", the clamping of the trailer bit counts, and the commit and rewind
+ * calls of the transmitter across repetitions.
+ */
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+#include "TxPayloadSource.hpp"
+
+namespace {
+
+const TxProtocolTable<
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>
+> txProtocolTable;
+
+constexpr int TX_PIN = 7;
+
+// "123456789" as 2 full double words and a last one with 8 bits.
+const uint32_t CHECK_DWORDS[] = {0x31323334, 0x35363738, 0x39};
+constexpr size_t CHECK_BIT_COUNT = 72;
+
+std::vector<bool> readBits(RcSwitchTx::TxPayloadSource& source) {
+  std::vector<bool> bits;
+  source.rewind();
+  for(size_t i = 0; i < source.bitCount(); i++) {
+    bits.push_back(source.nextBit());
+  }
+  return bits;
+}
+
+// The value of bitCount bits starting at position first, most significant first.
+uint32_t valueOf(const std::vector<bool>& bits, const size_t first, const size_t bitCount) {
+  uint32_t value = 0;
+  for(size_t i = first; i < first + bitCount; i++) {
+    value = (value << 1) | (bits[i] ? 1 : 0);
+  }
+  return value;
+}
+
+uint32_t trailerOf(const std::vector<bool>& bits, const size_t bitCount) {
+  return valueOf(bits, bits.size() - bitCount, bitCount);
+}
+
+// Bitwise CRC without reflection and without final XOR.
+uint32_t crcOf(const std::vector<bool>& bits, const size_t bitCount, const size_t width,
+    const uint32_t polynomial, const uint32_t init) {
+  const uint32_t topBit = static_cast<uint32_t>(1) << (width - 1);
+  const uint32_t mask = (topBit << 1) - 1;
+  uint32_t crc = init;
+  for(size_t i = 0; i < bitCount; i++) {
+    const bool feedback = ((crc & topBit) != 0) != bits[i];
+    crc = (crc << 1) & mask;
+    if(feedback) {
+      crc ^= polynomial;
+    }
+  }
+  return crc;
+}
+
+void checkDwordSource() {
+  RcSwitchTx::TxDwordSource source(CHECK_DWORDS, CHECK_BIT_COUNT);
+  TEST_CHECK(source.bitCount() == CHECK_BIT_COUNT);
+  const std::vector<bool> bits = readBits(source);
+  TEST_CHECK(valueOf(bits, 0, 32) == CHECK_DWORDS[0]);
+  TEST_CHECK(valueOf(bits, 32, 32) == CHECK_DWORDS[1]);
+  TEST_CHECK(valueOf(bits, 64, 8) == CHECK_DWORDS[2]);
+  // rewind() starts over.
+  TEST_CHECK(readBits(source) == bits);
+
+  // Fewer bits than a double word are taken from its low significant bits.
+  const uint32_t dword = 0xFFFFFFA5;
+  RcSwitchTx::TxDwordSource partial(&dword, 8);
+  TEST_CHECK(valueOf(readBits(partial), 0, 8) == 0xA5);
+}
+
+void checkCrcSources() {
+  RcSwitchTx::TxDwordSource payload(CHECK_DWORDS, CHECK_BIT_COUNT);
+
+  RcSwitchTx::TxCrc8Source crc8(payload);
+  TEST_CHECK(crc8.bitCount() == CHECK_BIT_COUNT + 8);
+  std::vector<bool> bits = readBits(crc8);
+  TEST_CHECK(valueOf(bits, 0, 32) == CHECK_DWORDS[0]);
+  TEST_CHECK(trailerOf(bits, 8) == 0xF4);
+  // The CRC restarts with each rewind.
+  TEST_CHECK(readBits(crc8) == bits);
+
+  RcSwitchTx::TxCrc16Source crc16(payload);
+  TEST_CHECK(crc16.bitCount() == CHECK_BIT_COUNT + 16);
+  bits = readBits(crc16);
+  TEST_CHECK(trailerOf(bits, 16) == 0x29B1);
+  TEST_CHECK(readBits(crc16) == bits);
+
+  // A 5 bit CRC, polynomial x^5 + x^2 + 1, over a short payload.
+  const uint32_t code = 0x2D;
+  RcSwitchTx::TxDwordSource shortPayload(&code, 6);
+  RcSwitchTx::TxCrcSource crc5(shortPayload, 5, 0x05, 0x1F);
+  bits = readBits(crc5);
+  TEST_CHECK(bits.size() == 6 + 5);
+  TEST_CHECK(trailerOf(bits, 5) == crcOf(bits, 6, 5, 0x05, 0x1F));
+}
+
+void checkXorChecksumSource() {
+  RcSwitchTx::TxDwordSource payload(CHECK_DWORDS, CHECK_BIT_COUNT);
+
+  // 0x31 ^ 0x32 ^ ... ^ 0x39
+  RcSwitchTx::TxXorChecksumSource xor8(payload);
+  TEST_CHECK(xor8.bitCount() == CHECK_BIT_COUNT + 8);
+  const std::vector<bool> bits = readBits(xor8);
+  TEST_CHECK(trailerOf(bits, 8) == 0x31);
+  TEST_CHECK(readBits(xor8) == bits);
+
+  // 0x3132 ^ 0x3334 ^ 0x3536 ^ 0x3738 ^ 0x39, the last chunk has 8 bits only.
+  RcSwitchTx::TxXorChecksumSource xor16(payload, 16);
+  TEST_CHECK(trailerOf(readBits(xor16), 16) == 0x0031);
+
+  // 0x31323334 ^ 0x35363738 ^ 0x39
+  RcSwitchTx::TxXorChecksumSource xor32(payload, 32);
+  TEST_CHECK(trailerOf(readBits(xor32), 32) == (0x31323334 ^ 0x35363738 ^ 0x39));
+}
+
+void checkCounterSource() {
+  RcSwitchTx::TxDwordSource payload(CHECK_DWORDS, CHECK_BIT_COUNT);
+  RcSwitchTx::TxCounterSource counter(payload, 8, 0xFE);
+  TEST_CHECK(counter.bitCount() == CHECK_BIT_COUNT + 8);
+  TEST_CHECK(trailerOf(readBits(counter), 8) == 0xFE);
+  // Repetitions don't count.
+  TEST_CHECK(trailerOf(readBits(counter), 8) == 0xFE);
+  counter.commit();
+  TEST_CHECK(trailerOf(readBits(counter), 8) == 0xFF);
+  // The counter wraps around within its bits.
+  counter.commit();
+  TEST_CHECK(counter.counter() == 0);
+  counter.setCounter(0x1FF);
+  TEST_CHECK(counter.counter() == 0xFF);
+
+  // A 32 bit counter wraps around as well.
+  RcSwitchTx::TxCounterSource counter32(payload, 32, 0xFFFFFFFF);
+  TEST_CHECK(trailerOf(readBits(counter32), 32) == 0xFFFFFFFF);
+  counter32.commit();
+  TEST_CHECK(counter32.counter() == 0);
+}
+
+void checkClamping() {
+  RcSwitchTx::TxDwordSource payload(CHECK_DWORDS, CHECK_BIT_COUNT);
+
+  RcSwitchTx::TxCounterSource counter0(payload, 0, 3);
+  TEST_CHECK(counter0.bitCount() == CHECK_BIT_COUNT + 1);
+  TEST_CHECK(counter0.counter() == 1);
+  RcSwitchTx::TxCounterSource counter40(payload, 40, 3);
+  TEST_CHECK(counter40.bitCount() == CHECK_BIT_COUNT + 32);
+  TEST_CHECK(trailerOf(readBits(counter40), 32) == 3);
+
+  RcSwitchTx::TxCrcSource crc0(payload, 0, 0x1, 0x0);
+  TEST_CHECK(crc0.bitCount() == CHECK_BIT_COUNT + 1);
+  RcSwitchTx::TxCrcSource crc20(payload, 20, 0x1021, 0xFFFF);
+  TEST_CHECK(crc20.bitCount() == CHECK_BIT_COUNT + 16);
+  // Clamped to 16 bits, it is CRC-16/CCITT-FALSE.
+  TEST_CHECK(trailerOf(readBits(crc20), 16) == 0x29B1);
+
+  RcSwitchTx::TxXorChecksumSource xor0(payload, 0);
+  TEST_CHECK(xor0.bitCount() == CHECK_BIT_COUNT + 1);
+  RcSwitchTx::TxXorChecksumSource xor33(payload, 33);
+  TEST_CHECK(xor33.bitCount() == CHECK_BIT_COUNT + 32);
+}
+
+// The bits of the repetitions of the recorded frame. Data 1 has a long A pulse.
+std::vector<std::vector<bool> > recordedRepetitions(const size_t bitCount) {
+  std::vector<std::vector<bool> > repetitions;
+  const std::vector<uint32_t> pulses = stubPulses();
+  // Leading synch, then bits and synch per repetition.
+  for(size_t first = 2; first + 2 * bitCount + 2 <= pulses.size(); first += 2 * bitCount + 2) {
+    std::vector<bool> bits;
+    for(size_t i = 0; i < bitCount; i++) {
+      bits.push_back(pulses[first + 2 * i] > pulses[first + 2 * i + 1]);
+    }
+    repetitions.push_back(bits);
+  }
+  return repetitions;
+}
+
+void checkRepeats() {
+  static RcSwitchTransmitter<TX_PIN> transmitter;
+  transmitter.begin(txProtocolTable.toTimingSpecTable());
+  transmitter.setRepeatCount(3);
+
+  // A counter protected by a CRC over the payload and the counter.
+  const uint32_t code = 0xA5;
+  RcSwitchTx::TxDwordSource payload(&code, 8);
+  RcSwitchTx::TxCounterSource counter(payload, 4, 14);
+  RcSwitchTx::TxCrc8Source crc(counter);
+
+  for(uint32_t expectedCounter = 14; expectedCounter < 18; expectedCounter++) {
+    stubReset();
+    TEST_CHECK(transmitter.send(0, crc) == RcSwitchTx::OK);
+    const std::vector<std::vector<bool> > repetitions = recordedRepetitions(crc.bitCount());
+    TEST_CHECK(repetitions.size() == 3);
+    for(size_t r = 0; r < repetitions.size(); r++) {
+      // Each repetition is the same frame with the counter value of this send().
+      TEST_CHECK(repetitions[r] == repetitions[0]);
+      TEST_CHECK(valueOf(repetitions[r], 0, 8) == code);
+      TEST_CHECK(valueOf(repetitions[r], 8, 4) == (expectedCounter & 0xF));
+      TEST_CHECK(trailerOf(repetitions[r], 8) == crcOf(repetitions[r], 12, 8, 0x07, 0x00));
+    }
+  }
+  // Committed once per send() through the CRC source.
+  TEST_CHECK(counter.counter() == 2);
+}
+
+} // anonymous name space
+
+int main() {
+  checkDwordSource();
+  checkCrcSources();
+  checkXorChecksumSource();
+  checkCounterSource();
+  checkClamping();
+  checkRepeats();
+  return testResult("PayloadSourceTest");
+}
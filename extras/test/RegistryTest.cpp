@@ -0,0 +1,111 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * Checks, that transmitters started with different protocol tables don't
+ * interfere, and that transmitters started with a registry share it.
+ */
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+
+namespace {
+
+const TxProtocolTable<
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>,
+  makeTxTimingSpec<650,  1,   10,    1,  3,    3,  1, false>
+> txProtocolTable433;
+
+const TxProtocolTable<
+  makeTxTimingSpec<100, 30,   71,    4, 11,    9,  6, false>
+> txProtocolTable315;
+
+// The first delay of a frame is synch pulse A.
+uint32_t firstDelay() {
+  const std::vector<uint32_t> pulses = stubPulses();
+  return pulses.empty() ? 0 : pulses.front();
+}
+
+size_t pulseCount() {
+  return stubPulses().size();
+}
+
+} // anonymous name space
+
+int main() {
+  static RcSwitchTransmitter<5> transmitter433;
+  static RcSwitchTransmitter<6> transmitter315;
+
+  // An instance holds a pointer to the registry and one to the power control.
+  TEST_CHECK(sizeof(transmitter433) == 2 * sizeof(void*));
+
+  // Before begin(), there is no table.
+  stubReset();
+  transmitter433.setRepeatCount(1);
+  TEST_CHECK(transmitter433.repeatCount() == RcSwitchTransmitter<5>::DEFAULT_REPEAT_CNT);
+  TEST_CHECK(transmitter433.send(0, 0x5, 4) == RcSwitchTx::INIT_ERR);
+  TEST_CHECK(stubEvents().empty());
+
+  transmitter433.begin(txProtocolTable433.toTimingSpecTable());
+  transmitter315.begin(txProtocolTable315.toTimingSpecTable());
+
+  // Each transmitter keeps its own table in the registry of its pin.
+  stubReset();
+  TEST_CHECK(transmitter433.send(0, 0x5, 4) == RcSwitchTx::OK);
+  TEST_CHECK(firstDelay() == 350);
+  stubReset();
+  TEST_CHECK(transmitter433.send(1, 0x5, 4) == RcSwitchTx::OK);
+  TEST_CHECK(firstDelay() == 650);
+  stubReset();
+  TEST_CHECK(transmitter315.send(0, 0x5, 4) == RcSwitchTx::OK);
+  TEST_CHECK(firstDelay() == 3000);
+  TEST_CHECK(transmitter315.send(1, 0x5, 4) == RcSwitchTx::INIT_ERR);
+
+  // ... and its own repeat count.
+  transmitter433.setRepeatCount(1);
+  TEST_CHECK(transmitter433.repeatCount() == 1);
+  TEST_CHECK(transmitter315.repeatCount() == RcSwitchTransmitter<6>::DEFAULT_REPEAT_CNT);
+  stubReset();
+  transmitter315.send(0, 0x5, 4);
+  TEST_CHECK(pulseCount() == 2 + RcSwitchTransmitter<6>::DEFAULT_REPEAT_CNT * 2 * (4 + 1));
+
+  // Transmitters started with the same registry share the table and the repeat count.
+  static RcSwitchTx::TxProtocolRegistry registry;
+  registry.begin(txProtocolTable433.toTimingSpecTable());
+  transmitter433.begin(registry);
+  transmitter315.begin(registry);
+  transmitter433.setRepeatCount(2);
+  TEST_CHECK(transmitter315.repeatCount() == 2);
+  stubReset();
+  TEST_CHECK(transmitter315.send(1, 0x5, 4) == RcSwitchTx::OK);
+  TEST_CHECK(firstDelay() == 650);
+
+  // Starting with a table again leaves the shared registry.
+  transmitter315.begin(txProtocolTable315.toTimingSpecTable());
+  TEST_CHECK(transmitter315.send(1, 0x5, 4) == RcSwitchTx::INIT_ERR);
+  TEST_CHECK(transmitter433.send(1, 0x5, 4) == RcSwitchTx::OK);
+
+  return testResult("RegistryTest");
+}
@@ -0,0 +1,98 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * Runs the AVR branch of sendStatic() against AvrStub.hpp and checks, that the
+ * delay loops plus the cycles between the edges give the nominal pulse durations.
+ */
+
+#include "AvrStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+#include "internal/TxStaticEmitter.hpp"
+
+namespace {
+
+typedef makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false> normalSpec;
+typedef makeTxTimingSpec<450,  1,   23,    1,  2,    2,  1, true> inverseSpec;
+
+constexpr int TX_PIN = 5;
+constexpr uint32_t CYCLES_PER_USEC = F_CPU / 1000000UL;
+constexpr uint32_t WRITE_CYCLES = RCSWITCH_TRANSMITTER_STATIC_WRITE_CYCLES;
+constexpr uint32_t BIT_CYCLES = RCSWITCH_TRANSMITTER_STATIC_BIT_CYCLES;
+
+size_t checkedDelays = 0;
+
+// Check the next recorded delay. The overhead is the number of cycles outside of the delay loop.
+void checkDelay(const int level, const uint32_t usec, const uint32_t overhead) {
+  const size_t i = checkedDelays++;
+  TEST_CHECK(i < avrDelays.size());
+  if(i < avrDelays.size()) {
+    TEST_CHECK(avrDelays[i].level == level);
+    TEST_CHECK(avrDelays[i].cycles + overhead == usec * CYCLES_PER_USEC);
+  }
+}
+
+void checkFrame(const uint32_t code, const size_t bitCount, const size_t repeatCount,
+    const uint32_t clock) {
+  checkDelay(HIGH, clock, WRITE_CYCLES);
+  checkDelay(LOW, 31 * clock, WRITE_CYCLES);
+  for(size_t repeat = 0; repeat < repeatCount; repeat++) {
+    for(size_t i = bitCount; i > 0; i--) {
+      const bool bit = (code >> (i - 1)) & 1;
+      checkDelay(HIGH, (bit ? 3 : 1) * clock, WRITE_CYCLES);
+      checkDelay(LOW, (bit ? 1 : 3) * clock, WRITE_CYCLES + BIT_CYCLES);
+    }
+    checkDelay(HIGH, clock, WRITE_CYCLES);
+    checkDelay(LOW, 31 * clock, WRITE_CYCLES);
+  }
+}
+
+} // anonymous name space
+
+int main() {
+  // A normal frame with 2 repeats
+  const uint32_t code = 0xA5;
+  RcSwitchTx::sendStaticFrame<normalSpec>(TX_PIN, &code, 8, 2);
+  checkFrame(code, 8, 2, 350);
+  TEST_CHECK(checkedDelays == avrDelays.size());
+  TEST_CHECK(avrSREG == 0x80);
+
+  // An inverse frame, the synch is 23 clocks long.
+  avrDelays.clear();
+  checkedDelays = 0;
+  RcSwitchTx::sendStaticFrame<inverseSpec>(TX_PIN, &code, 2, 1);
+  checkDelay(LOW, 450, WRITE_CYCLES);
+  checkDelay(HIGH, 23 * 450, WRITE_CYCLES);
+  checkDelay(LOW, 450, WRITE_CYCLES);
+  checkDelay(HIGH, 2 * 450, WRITE_CYCLES + BIT_CYCLES);
+  checkDelay(LOW, 2 * 450, WRITE_CYCLES);
+  checkDelay(HIGH, 450, WRITE_CYCLES + BIT_CYCLES);
+  checkDelay(LOW, 450, WRITE_CYCLES);
+  checkDelay(HIGH, 23 * 450, WRITE_CYCLES);
+  TEST_CHECK(checkedDelays == avrDelays.size());
+  TEST_CHECK(avrSREG == 0x80);
+
+  return testResult("StaticEmitterAvrTest");
+}
@@ -0,0 +1,98 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+/*
+ * Checks, that sendStatic() produces the same waveform as send(). Built with
+ * RCSWITCH_TRANSMITTER_TICKS_PER_USEC=4, so that the fractions of a microsecond
+ * must be carried over from pulse to pulse.
+ */
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+
+namespace {
+
+// Clocks of 350, 90.25 and 10.75 usec
+const TxProtocolTable<
+  makeTxTimingSpec<350,  1,   31,    1,  3,    3,  1, false>,
+  makeTxTimingSpecTicks<361,  1,   31,    1,  3,    3,  1, true>,
+  makeTxTimingSpecTicks<43,  10,   71,    4, 11,    9,  6, false>
+> txProtocolTable;
+
+constexpr int TX_PIN = 7;
+
+uint32_t totalDelay() {
+  uint32_t usec = 0;
+  const std::vector<uint32_t> pulses = stubPulses();
+  for(size_t i = 0; i < pulses.size(); i++) {
+    usec += pulses[i];
+  }
+  return usec;
+}
+
+bool sameEvents(const std::vector<StubEvent>& a, const std::vector<StubEvent>& b) {
+  if(a.size() != b.size()) {
+    return false;
+  }
+  for(size_t i = 0; i < a.size(); i++) {
+    if(a[i].kind != b[i].kind || a[i].pin != b[i].pin || a[i].level != b[i].level || a[i].usec != b[i].usec) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anonymous name space
+
+int main() {
+  static RcSwitchTransmitter<TX_PIN> transmitter;
+  transmitter.begin(txProtocolTable.toTimingSpecTable());
+
+  const uint32_t dwords[] = {0xDEADBEEF, 0x2A};
+  const size_t bitCounts[] = {1, 7, 24, 32, 38};
+
+  for(size_t protocolIndex = 0; protocolIndex < txProtocolTable.ROW_COUNT; protocolIndex++) {
+    for(size_t b = 0; b < sizeof(bitCounts) / sizeof(bitCounts[0]); b++) {
+      stubReset();
+      TEST_CHECK(transmitter.send(protocolIndex, dwords, bitCounts[b]) == RcSwitchTx::OK);
+      const std::vector<StubEvent> expected = stubEvents();
+      stubReset();
+      TEST_CHECK(transmitter.sendStatic(txProtocolTable, protocolIndex, dwords, bitCounts[b]) == RcSwitchTx::OK);
+      TEST_CHECK(sameEvents(stubEvents(), expected));
+    }
+  }
+
+  // The rounding errors don't accumulate: (1 + 31) + 3 * (32 * 4 + 1 + 31) clocks of 90.25 usec.
+  transmitter.setRepeatCount(3);
+  stubReset();
+  transmitter.sendStatic(txProtocolTable, 1, dwords, 32);
+  TEST_CHECK(totalDelay() == (361 * (3 * (1 + 31 + 32 * 4) + 1 + 31)) / 4);
+
+  stubReset();
+  TEST_CHECK(transmitter.sendStatic(txProtocolTable, txProtocolTable.ROW_COUNT, dwords, 24) == RcSwitchTx::INIT_ERR);
+  TEST_CHECK(stubEvents().empty());
+
+  return testResult("StaticEmitterTest");
+}
@@ -0,0 +1,82 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCHTRANSMITTER_TEST_STUB_HPP_
+#define RCSWITCHTRANSMITTER_TEST_STUB_HPP_
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+
+/*
+ * Built with STUB_NO_RECORDING, digitalWrite() and delayMicroseconds() only keep
+ * the level and the time. Nothing is recorded and no interrupt is called, so that
+ * benchmarks measure the library instead of the stub.
+ */
+
+/** A recorded call of digitalWrite() or delayMicroseconds(). */
+struct StubEvent {
+  enum KIND {WRITE, DELAY} kind;
+  int pin;          // WRITE only
+  int level;        // WRITE only
+  uint32_t usec;    // DELAY only
+};
+
+/** Clear the recorded events, the serial buffers and the pin wiring. */
+void stubReset();
+
+const std::vector<StubEvent>& stubEvents();
+
+/** The recorded delays, consecutive delays summed up to one pulse. */
+std::vector<uint32_t> stubPulses();
+
+/** Connect rxPin to txPin, so that rxPin follows the level of txPin. */
+void stubWire(int txPin, int rxPin);
+
+/** Advance the time, e.g. to model the cost of an interrupt. */
+void stubAdvance(uint32_t usec);
+
+/** Everything, that has been written to Serial. */
+std::string& stubSerialOutput();
+
+/** Let Serial read from and write to a file descriptor, e.g. a pty. -1 to detach. */
+void stubSerialAttach(int fd);
+
+extern int gTestFailures;
+
+#define TEST_CHECK(condition) do { \
+    if(not (condition)) { \
+      ++gTestFailures; \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+    } \
+  } while(false)
+
+/** Print the result and return the exit code for main(). */
+int testResult(const char* name);
+
+#endif /* RCSWITCHTRANSMITTER_TEST_STUB_HPP_ */
@@ -0,0 +1,201 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+/*
+ * Checks the trace output against send() and the dump. Built with
+ * RCSWITCH_TRANSMITTER_TICKS_PER_USEC=2, so that times are written in nsec.
+ */
+
+#include <stdlib.h>
+
+#include "TestStub.hpp"
+#include "RcSwitchTransmitter.hpp"
+
+namespace {
+
+// Conrad RS-200: Long synch and long data pulses.
+const TxProtocolTable<
+  makeTxTimingSpec<200,  3,  130,    7, 16,    3, 16, false>
+> txProtocolTable;
+
+constexpr int TX_PIN = 7;
+
+struct Pulse {
+  int level;
+  unsigned long long nsec;
+};
+
+// The time stamp of the last "#<time>" line of a VCD trace.
+unsigned long long lastTimestamp(const std::string& vcd) {
+  const size_t pos = vcd.rfind('#');
+  return pos == std::string::npos ? 0 : strtoull(vcd.c_str() + pos + 1, nullptr, 10);
+}
+
+std::vector<std::string> splitLines(const std::string& text) {
+  std::vector<std::string> lines;
+  size_t start = 0;
+  for(size_t end = text.find("\r\n"); end != std::string::npos; end = text.find("\r\n", start)) {
+    lines.push_back(text.substr(start, end - start));
+    start = end + 2;
+  }
+  TEST_CHECK(start == text.size());
+  return lines;
+}
+
+// A header line, then one "level,nsec" line per pulse.
+std::vector<Pulse> csvPulses(const std::string& csv) {
+  std::vector<Pulse> pulses;
+  const std::vector<std::string> lines = splitLines(csv);
+  TEST_CHECK(not lines.empty() && lines[0] == "level,nsec");
+  for(size_t i = 1; i < lines.size(); i++) {
+    const std::string& line = lines[i];
+    TEST_CHECK(line.size() > 2 && (line[0] == '0' || line[0] == '1') && line[1] == ',');
+    pulses.push_back(Pulse{line[0] == '1' ? HIGH : LOW, strtoull(line.c_str() + 2, nullptr, 10)});
+  }
+  return pulses;
+}
+
+// Each pulse starts with a "#<time>" line followed by a "<level>!" line. The last
+// "#<time>" line marks the end of the last pulse.
+std::vector<Pulse> vcdPulses(const std::string& vcd) {
+  std::vector<Pulse> pulses;
+  const std::vector<std::string> lines = splitLines(vcd);
+  unsigned long long time = 0;
+  bool definitions = true;
+  for(size_t i = 0; i < lines.size(); i++) {
+    const std::string& line = lines[i];
+    if(definitions) {
+      definitions = line != "$enddefinitions $end";
+    } else if(line[0] == '#') {
+      const unsigned long long next = strtoull(line.c_str() + 1, nullptr, 10);
+      if(not pulses.empty()) {
+        pulses.back().nsec = next - time;
+      }
+      time = next;
+    } else {
+      TEST_CHECK(line == "0!" || line == "1!");
+      pulses.push_back(Pulse{line[0] == '1' ? HIGH : LOW, 0});
+    }
+  }
+  return pulses;
+}
+
+// The pulses, that send() has written to the pin.
+std::vector<Pulse> sentPulses() {
+  std::vector<Pulse> pulses;
+  const std::vector<StubEvent>& events = stubEvents();
+  for(size_t i = 0; i < events.size(); i++) {
+    if(events[i].kind == StubEvent::WRITE) {
+      pulses.push_back(Pulse{events[i].level, 0});
+    } else if(not pulses.empty()) {
+      pulses.back().nsec += 1000ULL * events[i].usec;
+    }
+  }
+  return pulses;
+}
+
+bool samePulses(const std::vector<Pulse>& a, const std::vector<Pulse>& b) {
+  if(a.size() != b.size()) {
+    return false;
+  }
+  for(size_t i = 0; i < a.size(); i++) {
+    if(a[i].level != b[i].level || a[i].nsec != b[i].nsec) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anonymous name space
+
+int main() {
+  static RcSwitchTransmitter<TX_PIN> transmitter;
+  transmitter.begin(txProtocolTable.toTimingSpecTable());
+
+  const uint32_t code = 0xA5A5A5;
+  const size_t bitCount = 24;
+  const size_t repeatCount = 50;
+
+  // The frame takes more than 2^32 nsec.
+  unsigned long long usec = 0;
+  for(size_t i = 0; i < bitCount; i++) {
+    usec += (code >> (bitCount - 1 - i)) & 1 ? 200 * (3 + 16) : 200 * (7 + 16);
+  }
+  usec = 200 * (3 + 130) + repeatCount * (usec + 200 * (3 + 130));
+  TEST_CHECK(1000ULL * usec > 0xFFFFFFFFULL);
+
+  stubReset();
+  TEST_CHECK(transmitter.trace(Serial, 0, &code, bitCount, RcSwitchTx::TX_TRACE_VCD) == RcSwitchTx::OK);
+  TEST_CHECK(stubSerialOutput().find("$timescale 1ns $end") != std::string::npos);
+  // No pin activity while tracing.
+  TEST_CHECK(stubEvents().empty());
+
+  // Both formats trace the same frame, that send() transmits.
+  stubReset();
+  TEST_CHECK(transmitter.send(0, &code, bitCount) == RcSwitchTx::OK);
+  const std::vector<Pulse> sent = sentPulses();
+  TEST_CHECK(sent.size() == 2 * (1 + RcSwitchTransmitter<TX_PIN>::DEFAULT_REPEAT_CNT * (bitCount + 1)));
+  stubReset();
+  transmitter.trace(Serial, 0, &code, bitCount, RcSwitchTx::TX_TRACE_VCD);
+  TEST_CHECK(samePulses(vcdPulses(stubSerialOutput()), sent));
+  stubReset();
+  transmitter.trace(Serial, 0, &code, bitCount, RcSwitchTx::TX_TRACE_CSV);
+  TEST_CHECK(samePulses(csvPulses(stubSerialOutput()), sent));
+
+  // The CSV lines: a header and the synch of 3 and 130 clocks first.
+  const std::vector<std::string> lines = splitLines(stubSerialOutput());
+  TEST_CHECK(lines.size() == 1 + sent.size());
+  TEST_CHECK(lines.size() > 2 && lines[0] == "level,nsec" && lines[1] == "1,600000" && lines[2] == "0,26000000");
+
+  // An explicit repeat count traces like send() with that repeat count, the
+  // repeat count of the transmitter is left untouched.
+  stubReset();
+  TEST_CHECK(transmitter.send(0, code, bitCount, 1) == RcSwitchTx::OK);
+  const std::vector<Pulse> sentOnce = sentPulses();
+  stubReset();
+  TEST_CHECK(transmitter.trace(Serial, 0, code, bitCount, 1, RcSwitchTx::TX_TRACE_CSV) == RcSwitchTx::OK);
+  TEST_CHECK(samePulses(csvPulses(stubSerialOutput()), sentOnce));
+  TEST_CHECK(sentOnce.size() == 2 * (1 + 1 * (bitCount + 1)));
+  TEST_CHECK(transmitter.repeatCount() == RcSwitchTransmitter<TX_PIN>::DEFAULT_REPEAT_CNT);
+
+  // An invalid protocol index writes nothing.
+  stubReset();
+  TEST_CHECK(transmitter.trace(Serial, 1, code, bitCount, 1) == RcSwitchTx::INIT_ERR);
+  TEST_CHECK(stubSerialOutput().empty());
+
+  // The time stamps of the frame with 50 repeats don't wrap.
+  transmitter.setRepeatCount(repeatCount);
+  stubReset();
+  transmitter.trace(Serial, 0, &code, bitCount, RcSwitchTx::TX_TRACE_VCD);
+  TEST_CHECK(lastTimestamp(stubSerialOutput()) == 1000ULL * usec);
+
+  // The dump converts the ticks to nsec as well.
+  stubReset();
+  txProtocolTable.dumpTimingSpec(Serial);
+  TEST_CHECK(stubSerialOutput().find("[nsec]") != std::string::npos);
+  TEST_CHECK(stubSerialOutput().find(" 0,0,{600000,26000000}{1400000,3200000}{600000,3200000}")
+      != std::string::npos);
+
+  return testResult("TraceTest");
+}
@@ -30,6 +30,7 @@
 #include <Arduino.h>
 
 #include "internal/ISR_ATTR.hpp"
+#include "internal/TxDuration.hpp"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -115,6 +116,68 @@ template<
   bool inverseLevel>               /* Flag whether pulse levels are normal or inverse. */
 struct makeTxTimingSpec;
 
+/**
+ * makeTxTimingSpecTicks
+ *
+ * Same as makeTxTimingSpec, but the clock is given in ticks instead of microseconds.
+ * Pulse durations are stored in ticks of 1/RCSWITCH_TRANSMITTER_TICKS_PER_USEC
+ * microseconds (default 1) with the type RCSWITCH_TRANSMITTER_DURATION_TYPE
+ * (default unsigned int, which is 16 bit on AVR). Both can be set as build flags,
+ * e.g. -DRCSWITCH_TRANSMITTER_TICKS_PER_USEC=4 -DRCSWITCH_TRANSMITTER_DURATION_TYPE=uint32_t
+ * for a resolution of 0.25 usec and pulses longer than 65535 ticks. The transmitter
+ * carries the fraction of a microsecond over to the next pulse, so that rounding
+ * errors don't accumulate over the frame. They must be build flags for the library
+ * as well. A #define in the sketch only makes the sketch fail to link with an
+ * undefined reference to RcSwitchTx::checkDurationConfiguration().
+ *
+ * //                       clk, syA,  syB,  d0A,d0B,  d1A,d1B, inverseLevel
+ *    makeTxTimingSpecTicks<401,  30,   71,    4, 11,    9,  6, false>, // clk is 100.25 usec with 4 ticks per usec
+ */
+template<
+  RcSwitchTx::tx_duration_t ticksClock,  /* The clock rate in ticks.  */
+  unsigned int synchA,  unsigned int synchB,   /* Number of clocks for the synchronization pulse pair. */
+  unsigned int data0_A, unsigned int data0_B,  /* Number of clocks for a logical 0 bit data pulse pair. */
+  unsigned int data1_A, unsigned int data1_B,  /* Number of clocks for a logical 1 bit data pulse pair. */
+  bool inverseLevel>               /* Flag whether pulse levels are normal or inverse. */
+struct makeTxTimingSpecTicks;
+
+/**
+ * RxTolerance
+ *
+ * Describes which pulses a receiver accepts: A pulse is accepted, if it is not
+ * shorter than the nominal duration reduced by percentTolerance. usecMargin is
+ * added on top of that lower bound as safety margin for the jitter of the
+ * transmitter. Use the same percentTolerance as the receiver. E.g. RcSwitchReceiver
+ * makeTimingSpec<350, 20, ...> corresponds to RxTolerance<20, usecMargin>.
+ */
+template<unsigned int percentTolerance, unsigned int usecMargin> struct RxTolerance;
+
+/**
+ * makeShortTxTimingSpec
+ *
+ * Like makeTxTimingSpec, but each pulse is shortened at compile time to the
+ * shortest duration that the receiver described by RX_TOLERANCE still accepts.
+ * The transmitter timing correction (RCSWITCH_TRANSMITTER_TIMING_CORRECTION),
+ * which compensates the measured transmit overhead, is applied on top as for
+ * any other timing specification. Shorter pulses result in shorter frames and
+ * thus more frames per second. makeShortTxTimingSpec and makeTxTimingSpec rows
+ * can be mixed in a TxProtocolTable.
+ *
+ * static const TxProtocolTable <
+ * //                                          clk, syA,  syB,  d0A,d0B,  d1A,d1B, inverseLevel
+ *    makeShortTxTimingSpec<RxTolerance<20,30>, 350,   1,   31,    1,  3,    3,  1, false>, // (PT2262)
+ *    makeTxTimingSpec<                         650,   1,   10,    1,  3,    3,  1, false>  // ()
+ *  > txProtocolTable;
+ */
+template<
+  typename RX_TOLERANCE,                 /* The receiver tolerance. E.g. RxTolerance<20,30> */
+  unsigned int usecClock,                /* The clock rate in microseconds.  */
+  unsigned int synchA,  unsigned int synchB,   /* Number of clocks for the synchronization pulse pair. */
+  unsigned int data0_A, unsigned int data0_B,  /* Number of clocks for a logical 0 bit data pulse pair. */
+  unsigned int data1_A, unsigned int data1_B,  /* Number of clocks for a logical 1 bit data pulse pair. */
+  bool inverseLevel>               /* Flag whether pulse levels are normal or inverse. */
+struct makeShortTxTimingSpec;
+
 /**
  * RxProtocolTable
  *
@@ -144,10 +207,31 @@ struct makeTxTimingSpec;
  *  txProtocolTable.dumpTimingSpec(serial);
  *  ...
  *
+ *  The table is validated at compile time. Compilation fails, if a pulse duration
+ *  overflows unsigned int (16 bit on AVR), if a pulse duration is zero or not longer
+ *  than the transmitter timing correction, or if 2 rows produce the same pulses.
  */
 template<typename T, typename ...R> struct TxProtocolTable;
+
+/**
+ * makeUniqueTxProtocolTable
+ *
+ * Same as TxProtocolTable, but rows that produce the same pulses as a previous row
+ * are dropped at compile time instead of failing the compilation. Note that the
+ * protocol index of the rows behind a dropped row is reduced accordingly.
+ *
+ * static const makeUniqueTxProtocolTable <
+ *    makeTxTimingSpec<350,   1,   31,    1,  3,    3,  1, false>, // [0]
+ *    makeTxTimingSpec<175,   2,   62,    2,  6,    6,  2, false>, // dropped, same as [0]
+ *    makeTxTimingSpec<650,   1,   10,    1,  3,    3,  1, false>  // [1]
+ *  > txProtocolTable;
+ *
+ * makeUniqueTxProtocolTable is an alias template and is defined along with
+ * TxProtocolTable in internal/TxProtocolTimingSpec.hpp.
+ */
 #include "internal/TxProtocolTimingSpec.hpp"
 #include "internal/RcSwitchTransmitterBase.hpp"
+#include "internal/TxStaticEmitter.hpp"
 /**
  * This is the library API class for transmitting data to a remote control receiver.
  * The IO pin to be used is defined at compile time by the template
@@ -160,10 +244,37 @@ template<typename T, typename ...R> struct TxProtocolTable;
  * RcSwitchTransmitter<5> rcSwitchTransmitter433;
  * RcSwitchTransmitter<6> rcSwitchTransmitter315;
  *
+ * An instance holds just 2 pointers, one to a protocol registry and one to an
+ * optional power control. The emit core is not a template and is shared by all
+ * instances. Instances can share a TxProtocolRegistry, that holds the protocol
+ * table and the repeat count:
+ *
+ * static RcSwitchTx::TxProtocolRegistry registry;
+ * ...
+ * registry.begin(txProtocolTable.toTimingSpecTable());
+ * rcSwitchTransmitter433.begin(registry);
+ * rcSwitchTransmitter315.begin(registry);
+ *
+ * Instances started with a protocol table instead use a registry of their IO
+ * pin. It is a static variable, that is only linked in, if begin() is called with
+ * a table for that pin. So the 433Mhz and the 315Mhz transmitter above can be
+ * started with different tables and repeat counts.
+ *
  * If you have a 2nd Arduino, you can run the example sketch 'PrintReceivedData'
  * from:
  *    https://github.com/dac1e/RcSwitchReceiver/
  * to watch what a transmitter is doing.
+ *
+ * For battery powered nodes, build with -DRCSWITCH_TRANSMITTER_LOW_POWER_DELAY=true.
+ * The CPU then idles during long pulses (AVR idle sleep mode, wfi on the SAM, SAMD
+ * and STM32 cores) and is woken up by the periodic interrupt that drives millis().
+ * Only the last part of a pulse, that is shorter than RCSWITCH_TRANSMITTER_IDLE_WAKEUP_USEC
+ * (1200 usec), is busy waited. On other cores the delay stays busy waiting, unless
+ * RCSWITCH_TRANSMITTER_IDLE() is defined by the build.
+ *
+ * In practice only the low time of the synch idles. For protocol 1 (350 usec base
+ * time) that are about 9.6 msec of the 10.85 msec synch low time, which is about
+ * 20% of a 24 bit repetition (44.8 msec). The data bits are always busy waited.
  */
 
 using RcSwitchTx::TxTimingSpecTable;
@@ -171,29 +282,66 @@ using RcSwitchTx::TxTimingSpecTable;
 template<int IOPIN> class RcSwitchTransmitter : protected RcSwitchTx::RcSwitchTransmitterBase {
   typedef RcSwitchTx::RcSwitchTransmitterBase base_t;
 public:
-  static constexpr size_t DEFAULT_REPEAT_CNT = 3;
+  static constexpr size_t DEFAULT_REPEAT_CNT = RcSwitchTx::TxProtocolRegistry::DEFAULT_REPEAT_CNT;
 
   /**
    * Default constructor
    */
-  RcSwitchTransmitter() : base_t(DEFAULT_REPEAT_CNT) {}
+  RcSwitchTransmitter() : base_t() {}
 
   /**
    * Sets the protocol timing specification table to be used for transmitting data.
+   * The table and the repeat count are held by the registry of the IO pin.
    * Sets up pin mode.
    */
   void begin(const TxTimingSpecTable& txTimingSpecTable) {
-    base_t::begin(txTimingSpecTable);
+    pinRegistry.begin(txTimingSpecTable);
+    base_t::begin(pinRegistry);
+    pinMode(IOPIN, OUTPUT);
+  }
+
+  /**
+   * Use the protocol table and the repeat count of the given registry.
+   * Sets up pin mode.
+   */
+  void begin(RcSwitchTx::TxProtocolRegistry& registry) {
+    base_t::begin(registry);
     pinMode(IOPIN, OUTPUT);
   }
 
   /**
+   * Sets the repeat count of the registry. If the transmitter has been started
+   * with a shared registry, it applies to all transmitters sharing it. Call it
+   * after begin(), because there is no registry before.
    * It is recommended to set the repeat count not lower than 3.
    */
   inline void setRepeatCount(const size_t repeatCount) {
     base_t::setRepeatCount(repeatCount);
   }
 
+  inline size_t repeatCount() const {
+    return base_t::repeatCount();
+  }
+
+  /**
+   * Use an enable pin to switch the transmitter module on only while sending.
+   * The enable pin is driven high to enable the module. After enabling, the
+   * transmission is delayed by the warm up time, so that the first synch pulse
+   * doesn't get lost. With a proper warm up time a lower repeat count may be
+   * sufficient. The module is disabled again, when no send() call has been made
+   * for the idle timeout. So subsequent calls to send() within that time don't
+   * pay the warm up time again. An idle timeout of 0 disables the module right
+   * after each send() call. Otherwise call handleIdle() of the power control
+   * regularly, e.g. from loop().
+   *
+   * static RcSwitchTx::TxPowerControl powerControl(TX433_ENABLE_PIN, 1000, 500);
+   * ...
+   * rcSwitchTransmitter.setPowerControl(powerControl);
+   */
+  inline void setPowerControl(RcSwitchTx::TxPowerControl& powerControl) {
+    base_t::setPowerControl(powerControl);
+  }
+
   inline RcSwitchTx::RESULT send(const size_t protocolIndex, const uint32_t code, const size_t bitCount) {
     return base_t::send(IOPIN, protocolIndex, &code, bitCount);
   }
@@ -214,6 +362,159 @@ public:
     return base_t::send(IOPIN, protocolIndex, dwords, bitCount);
   }
 
+  /**
+   * Send with the given repeat count instead of the repeat count of the registry.
+   * The registry is left untouched, so transmitters sharing it are not affected.
+   */
+  inline RcSwitchTx::RESULT send(const size_t protocolIndex, const uint32_t code, const size_t bitCount,
+      const size_t repeatCount) {
+    return base_t::send(IOPIN, protocolIndex, &code, bitCount, repeatCount);
+  }
+
+  inline RcSwitchTx::RESULT send(const size_t protocolIndex, const uint32_t* const dwords,
+      const size_t bitCount, const size_t repeatCount) {
+    return base_t::send(IOPIN, protocolIndex, dwords, bitCount, repeatCount);
+  }
+
+  /**
+   * Send a code and verify the transmitted pulses with a loopback, that captures the
+   * edges on a receive pin wired to the data line. The report tells the number of
+   * bit errors and the worst case pulse deviation. Returns LOOPBACK_ERR, if no edge
+   * has been captured, e.g. because the receive pin isn't wired.
+   *
+   * static RcSwitchTx::TxLoopback loopback;
+   * loopback.begin(TX433_LOOPBACK_PIN);
+   * ...
+   * RcSwitchTx::TxLoopbackReport report;
+   * rcSwitchTransmitter.send(PROTOCOL_INDEX, BUTTON_CODE_DEMO, 24, loopback, report);
+   */
+  inline RcSwitchTx::RESULT send(const size_t protocolIndex, const uint32_t code, const size_t bitCount,
+      RcSwitchTx::TxLoopback& loopback, RcSwitchTx::TxLoopbackReport& report) {
+    return base_t::send(IOPIN, protocolIndex, &code, bitCount, loopback, report);
+  }
+
+  inline RcSwitchTx::RESULT send(const size_t protocolIndex, const uint32_t* const dwords,
+      const size_t bitCount, RcSwitchTx::TxLoopback& loopback, RcSwitchTx::TxLoopbackReport& report) {
+    return base_t::send(IOPIN, protocolIndex, dwords, bitCount, loopback, report);
+  }
+
+  /**
+   * Send a payload that is pulled bit by bit from a payload source while transmitting.
+   * The source is rewound for each repetition and committed once after the last
+   * repetition. E.g. send a code followed by a rolling counter and a CRC-8:
+   *
+   * static uint32_t code = BUTTON_CODE_DEMO;
+   * static RcSwitchTx::TxDwordSource codeSource(&code, 16);
+   * static RcSwitchTx::TxCounterSource counterSource(codeSource, 8);
+   * static RcSwitchTx::TxCrc8Source crcSource(counterSource);
+   * rcSwitchTransmitter.send(PROTOCOL_INDEX, crcSource); // Sends 16 + 8 + 8 bits.
+   */
+  inline RcSwitchTx::RESULT send(const size_t protocolIndex, RcSwitchTx::TxPayloadSource& payload) {
+    return base_t::send(IOPIN, protocolIndex, payload);
+  }
+
+  /**
+   * Write the frame, that send() would transmit with the current repeat count, as
+   * value change dump (TX_TRACE_VCD) or as CSV pulse list (TX_TRACE_CSV) to the serial.
+   * The trace can be compared with a logic analyzer capture of the transmitter pin.
+   */
+  inline RcSwitchTx::RESULT trace(RcSwitchTx::Debug::serial_t &serial, const size_t protocolIndex,
+      const uint32_t code, const size_t bitCount,
+      const RcSwitchTx::TX_TRACE_FORMAT format = RcSwitchTx::TX_TRACE_VCD) {
+    return base_t::trace(serial, protocolIndex, &code, bitCount, format);
+  }
+
+  inline RcSwitchTx::RESULT trace(RcSwitchTx::Debug::serial_t &serial, const size_t protocolIndex,
+      const uint32_t* const dwords, const size_t bitCount,
+      const RcSwitchTx::TX_TRACE_FORMAT format = RcSwitchTx::TX_TRACE_VCD) {
+    return base_t::trace(serial, protocolIndex, dwords, bitCount, format);
+  }
+
+  /**
+   * Trace the frame, that send() would transmit with the given repeat count.
+   */
+  inline RcSwitchTx::RESULT trace(RcSwitchTx::Debug::serial_t &serial, const size_t protocolIndex,
+      const uint32_t code, const size_t bitCount, const size_t repeatCount,
+      const RcSwitchTx::TX_TRACE_FORMAT format = RcSwitchTx::TX_TRACE_VCD) {
+    return base_t::trace(serial, protocolIndex, &code, bitCount, repeatCount, format);
+  }
+
+  inline RcSwitchTx::RESULT trace(RcSwitchTx::Debug::serial_t &serial, const size_t protocolIndex,
+      const uint32_t* const dwords, const size_t bitCount, const size_t repeatCount,
+      const RcSwitchTx::TX_TRACE_FORMAT format = RcSwitchTx::TX_TRACE_VCD) {
+    return base_t::trace(serial, protocolIndex, dwords, bitCount, repeatCount, format);
+  }
+
+  /**
+   * Send several codes in one train, e.g. to switch multiple sockets at once.
+   * Each entry carries its own protocol index, code and bit count (max. 32 bits).
+   * The burst is rejected with INIT_ERR, if any entry has an invalid protocol index
+   * or more than 32 bits.
+   * Consecutive frames of the same protocol share the synch pulses between them.
+   * The repetitions are interleaved: All entries are sent once, then all entries
+   * are sent again, until the repeat count is reached. So each receiver sees its
+   * repetitions spaced apart by the frames for the other receivers.
+   *
+   * static const RcSwitchTx::TxBurstEntry scene[] = {
+   *   { 0, BUTTON_CODE_A, 24},
+   *   { 0, BUTTON_CODE_B, 24},
+   *   {11, BUTTON_CODE_DEMO, 24},
+   * };
+   * rcSwitchTransmitter.sendBurst(scene);
+   */
+  inline RcSwitchTx::RESULT sendBurst(const RcSwitchTx::TxBurstEntry* const entries, const size_t entryCount) {
+    return base_t::sendBurst(IOPIN, entries, entryCount);
+  }
+
+  template<size_t N>
+  inline RcSwitchTx::RESULT sendBurst(const RcSwitchTx::TxBurstEntry (&entries)[N]) {
+    return base_t::sendBurst(IOPIN, entries, N);
+  }
+
+  /**
+   * Send a code like send() does, but with an emit routine, that is generated for
+   * each row of the protocol table at compile time. The pulse durations and levels
+   * are constants in the generated code. On AVR, the pin is written through its
+   * port register and the pulses are timed by delay loops, that are computed from
+   * F_CPU, instead of the RCSWITCH_TRANSMITTER_TIMING_CORRECTION. The cycles for
+   * the port write and for the step to the next data bit are subtracted from the
+   * delays, see RCSWITCH_TRANSMITTER_STATIC_WRITE_CYCLES and
+   * RCSWITCH_TRANSMITTER_STATIC_BIT_CYCLES in TxStaticEmitter.hpp. Elsewhere, the
+   * same microseconds delay as for send() is used. The CPU doesn't idle during
+   * the pulses.
+   *
+   * The protocol index refers to the given table. The code for all rows of the table
+   * is linked in, so prefer send() for large tables on small targets.
+   *
+   * rcSwitchTransmitter.sendStatic(txProtocolTable, 0, BUTTON_CODE_A, 24);
+   */
+  template<typename ...T>
+  inline RcSwitchTx::RESULT sendStatic(const TxProtocolTable<T...>&, const size_t protocolIndex,
+      const uint32_t code, const size_t bitCount) {
+    return dispatchStatic<T...>(protocolIndex, &code, bitCount);
+  }
+
+  template<typename ...T>
+  inline RcSwitchTx::RESULT sendStatic(const TxProtocolTable<T...>&, const size_t protocolIndex,
+      const uint32_t* const dwords, const size_t bitCount) {
+    return dispatchStatic<T...>(protocolIndex, dwords, bitCount);
+  }
+
+private:
+  // Used by begin() with a protocol table.
+  static RcSwitchTx::TxProtocolRegistry pinRegistry;
+
+  template<typename ...T>
+  inline RcSwitchTx::RESULT dispatchStatic(const size_t protocolIndex, const uint32_t* const dwords,
+      const size_t bitCount) {
+    typedef RcSwitchTx::TxStaticSenderTable<T...> sender_table_t;
+    return base_t::sendStatic(IOPIN, sender_table_t::SENDERS, sender_table_t::ROW_COUNT,
+        protocolIndex, dwords, bitCount);
+  }
+
 };
 
+template<int IOPIN>
+RcSwitchTx::TxProtocolRegistry RcSwitchTransmitter<IOPIN>::pinRegistry;
+
 #endif /* RCSWITCH_TRANSMITTER_API_HPP_ */
@@ -0,0 +1,182 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCHTRANSMITTER_TX_COMMAND_HPP_
+#define RCSWITCHTRANSMITTER_TX_COMMAND_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Binary command protocol for driving a transmitter from a host over a serial link.
+ * This header and internal/TxCommand.cpp don't depend on Arduino, so they can be
+ * compiled for the host as well.
+ *
+ * A frame is:
+ *
+ *   SOF | LENGTH | SEQ | CMD | PAYLOAD[LENGTH] | CRC8
+ *
+ * SOF is TX_COMMAND_SOF. LENGTH is the number of payload bytes. SEQ is chosen by
+ * the host and is echoed in the response. CRC8 (polynomial 0x07) covers LENGTH up
+ * to the last payload byte.
+ *
+ * The payload of TX_COMMAND_SEND is:
+ *
+ *   PROTOCOL_INDEX | REPEAT_COUNT | BIT_COUNT | DATA
+ *
+ * A REPEAT_COUNT of 0 selects the repeat count of the transmitter. DATA holds the
+ * double words of the send() function in big endian order. The last double word
+ * is cut down to the bytes needed for its remaining bits.
+ *
+ * Each command is answered with TX_COMMAND_ACK or TX_COMMAND_NAK. The payload of
+ * the response is:
+ *
+ *   STATUS | FREE_SLOTS
+ *
+ * FREE_SLOTS is the number of send commands, that can be queued by the transmitter.
+ * The host must not have more send commands outstanding. A send command, that is
+ * accepted, is answered once more with TX_COMMAND_NAK, if it later fails to send.
+ *
+ * The host increments SEQ by one for each command and starts with a ping. After
+ * the ping, the transmitter accepts send commands in the order of SEQ only. A send
+ * command, that skips a SEQ, is answered with TX_COMMAND_SEQUENCE and the host
+ * resends the missing command and all later ones. A send command, that has been
+ * accepted already, is acknowledged again without being queued a second time. So
+ * a command can be resent safely, if its response got lost.
+ */
+
+#if not defined(RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS)
+  #define RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS 64
+#endif
+
+namespace RcSwitchTx {
+
+constexpr uint8_t TX_COMMAND_SOF = 0xA5;
+constexpr size_t TX_COMMAND_MAX_DWORDS = (RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS + 31) / 32;
+constexpr size_t TX_COMMAND_MAX_PAYLOAD = 3 + 4 * TX_COMMAND_MAX_DWORDS;
+constexpr size_t TX_COMMAND_MAX_FRAME = 5 + TX_COMMAND_MAX_PAYLOAD;
+
+enum TX_COMMAND {
+  TX_COMMAND_SEND = 0x01, // Queue a code for sending.
+  TX_COMMAND_PING = 0x02, // Query the number of free slots.
+  TX_COMMAND_ACK  = 0x80, // Response: Command accepted.
+  TX_COMMAND_NAK  = 0x81, // Response: Command rejected or failed.
+};
+
+enum TX_COMMAND_STATUS {
+  TX_COMMAND_OK = 0,      // Command accepted.
+  TX_COMMAND_BUSY,        // The queue is full. Resend the command later.
+  TX_COMMAND_INIT_ERR,    // Protocol index out of range or transmitter not started.
+  TX_COMMAND_CRC_ERR,     // The frame was corrupted. SEQ is the last valid one.
+  TX_COMMAND_INVALID,     // Unknown command or malformed payload.
+  TX_COMMAND_SEQUENCE,    // A previous send command is missing. Resend from there on.
+};
+
+/**
+ * A decoded frame.
+ */
+struct TxCommandFrame {
+  uint8_t seq;
+  uint8_t command;
+  uint8_t length;
+  uint8_t payload[TX_COMMAND_MAX_PAYLOAD];
+};
+
+/**
+ * A decoded send command.
+ */
+struct TxSendCommand {
+  uint8_t protocolIndex;
+  uint8_t repeatCount;
+  uint8_t bitCount;
+  uint32_t dwords[TX_COMMAND_MAX_DWORDS];
+};
+
+/**
+ * Update a CRC8 (polynomial 0x07) by one byte.
+ */
+uint8_t txCommandCrc8(uint8_t crc, const uint8_t byte);
+
+/**
+ * Encode a frame into buffer. Returns the size of the frame or 0, if it doesn't
+ * fit into the buffer.
+ */
+size_t encodeTxCommand(uint8_t* const buffer, const size_t bufferSize, const uint8_t seq,
+    const uint8_t command, const uint8_t* const payload, const size_t length);
+
+/**
+ * Encode a send command frame into buffer. Returns the size of the frame or 0, if it
+ * doesn't fit into the buffer or bitCount exceeds RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS.
+ */
+size_t encodeTxSendCommand(uint8_t* const buffer, const size_t bufferSize, const uint8_t seq,
+    const uint8_t protocolIndex, const uint8_t repeatCount, const uint32_t* const dwords,
+    const size_t bitCount);
+
+/**
+ * Decode the payload of a send command. Returns false, if the payload is malformed.
+ */
+bool decodeTxSendCommand(const TxCommandFrame& frame, TxSendCommand& sendCommand);
+
+/**
+ * Byte wise frame decoder.
+ */
+class TxCommandDecoder {
+public:
+  enum RESULT {
+    PENDING,    // More bytes are needed.
+    COMPLETE,   // frame() holds a valid frame.
+    CRC_ERR,    // A corrupted frame has been dropped.
+  };
+
+private:
+  enum STATE {
+    WAIT_SOF,
+    WAIT_LENGTH,
+    WAIT_SEQ,
+    WAIT_COMMAND,
+    WAIT_PAYLOAD,
+    WAIT_CRC,
+  };
+
+  STATE mState;
+  uint8_t mCrc;
+  uint8_t mIndex;
+  TxCommandFrame mFrame;
+
+public:
+  TxCommandDecoder() : mState(WAIT_SOF), mCrc(0), mIndex(0), mFrame() {}
+
+  /** Feed the next received byte. */
+  RESULT feed(const uint8_t byte);
+
+  inline const TxCommandFrame& frame() const {
+    return mFrame;
+  }
+};
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCHTRANSMITTER_TX_COMMAND_HPP_ */
@@ -0,0 +1,79 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCHTRANSMITTER_TX_COMMAND_SERVER_HPP_
+#define RCSWITCHTRANSMITTER_TX_COMMAND_SERVER_HPP_
+
+#include "RcSwitchTransmitter.hpp"
+#include "internal/TxCommandServerBase.hpp"
+
+/**
+ * Receives binary commands (see TxCommand.hpp) from a host over a serial link and
+ * sends the codes with a transmitter. Send commands are queued, so that the host
+ * can keep the link busy while a code is being sent. The queue can hold
+ * RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE send commands. Each response tells the
+ * host how many of them are still free.
+ *
+ * static RcSwitchTransmitter<TX433_DATA_PIN> rcSwitchTransmitter;
+ * static TxCommandServer<TX433_DATA_PIN> txCommandServer(rcSwitchTransmitter, Serial);
+ *
+ * void loop() {
+ *   txCommandServer.handle();
+ * }
+ */
+template<int IOPIN>
+class TxCommandServer : public RcSwitchTx::TxCommandServerBase {
+  typedef RcSwitchTx::TxCommandServerBase base_t;
+  RcSwitchTransmitter<IOPIN>& mTransmitter;
+
+  RcSwitchTx::RESULT send(const RcSwitchTx::TxSendCommand& command) {
+    // A repeat count of 0 selects the repeat count of the transmitter.
+    if (command.repeatCount == 0) {
+      return mTransmitter.send(command.protocolIndex, command.dwords, command.bitCount);
+    }
+    return mTransmitter.send(command.protocolIndex, command.dwords, command.bitCount,
+        command.repeatCount);
+  }
+
+public:
+  TxCommandServer(RcSwitchTransmitter<IOPIN>& transmitter, base_t::serial_t& serial)
+    : base_t(serial), mTransmitter(transmitter) {
+  }
+
+  /**
+   * Process the received commands and send the oldest queued code. Call this
+   * function regularly, e.g. from loop().
+   */
+  void handle() {
+    base_t::receive();
+    const RcSwitchTx::TxSendCommand* const command = base_t::front();
+    if (command) {
+      base_t::pop(send(*command));
+    }
+  }
+};
+
+#endif /* RCSWITCHTRANSMITTER_TX_COMMAND_SERVER_HPP_ */
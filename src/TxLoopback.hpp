@@ -0,0 +1,108 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCHTRANSMITTER_TX_LOOPBACK_HPP_
+#define RCSWITCHTRANSMITTER_TX_LOOPBACK_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "internal/TxProtocolTimingSpec.hpp"
+
+#if not defined(RCSWITCH_TRANSMITTER_LOOPBACK_CAPACITY)
+#if defined(__AVR__)
+  #define RCSWITCH_TRANSMITTER_LOOPBACK_CAPACITY 160  // pulses, 320 bytes
+#else
+  #define RCSWITCH_TRANSMITTER_LOOPBACK_CAPACITY 512  // pulses
+#endif
+#endif
+
+namespace RcSwitchTx {
+
+/**
+ * The result of verifying a transmitted frame against its timing specification.
+ */
+struct TxLoopbackReport {
+  size_t pulseCount;           // Number of pulses that have been verified.
+  size_t bitErrors;            // Number of data bits with a pulse outside the tolerance.
+  size_t synchErrors;          // Number of synchs with a pulse outside the tolerance.
+  uint32_t maxDeviation;       // Worst case deviation of a pulse from its nominal duration in usec.
+  bool truncated;              // The frame had more pulses than could be captured.
+};
+
+/**
+ * Captures the edges on a receive pin, that is wired to the data line of the
+ * transmitter, while a frame is being sent. The captured pulses are then compared
+ * with the pulses of the timing specification.
+ *
+ * The edges are captured by an interrupt, so the receive pin must be interrupt
+ * capable. Only one TxLoopback can be in use at a time. The interrupt stores the
+ * duration since the previous edge as 16 bits, so that the default capacity on AVR
+ * holds a complete 24 bit frame with 3 repeats (152 pulses). Durations above
+ * 65535 usec are saturated, both captured and nominal ones.
+ *
+ * The number of pulses, that can be captured, is RCSWITCH_TRANSMITTER_LOOPBACK_CAPACITY
+ * including the idle time between arming and the first edge. For frames with more
+ * pulses, only the captured pulses are verified and the report is marked as
+ * truncated. The pulses, that haven't been captured, are not counted as errors.
+ *
+ * If the pin is already at the level of the first pulse when arming, the first
+ * pulse has no leading edge. It is then measured from the time of arming.
+ */
+class TxLoopback {
+  int mRxPin;
+  unsigned int mPercentTolerance;
+  int mArmLevel;
+public:
+  TxLoopback() : mRxPin(-1), mPercentTolerance(0), mArmLevel(0) {}
+
+  /**
+   * Set the receive pin and the tolerance for a pulse to be considered as correct.
+   */
+  void begin(const int rxPin, const unsigned int percentTolerance = 20);
+
+  /** Start capturing edges. */
+  void arm();
+
+  /** Stop capturing edges. */
+  void disarm();
+
+  /**
+   * Compare the captured pulses with the frame for the given parameters. Returns
+   * false, if no edge has been captured at all.
+   */
+  bool verify(const TxTimingSpec &timingSpec, const uint32_t* const dwords,
+      const size_t totalBitCount, const size_t repeatCount, TxLoopbackReport& report) const;
+};
+
+namespace Debug {
+  /** Print the report as one line. */
+  void printLoopbackReport(serial_t &serial, const TxLoopbackReport& report);
+}
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCHTRANSMITTER_TX_LOOPBACK_HPP_ */
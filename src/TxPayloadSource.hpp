@@ -0,0 +1,186 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCHTRANSMITTER_TX_PAYLOAD_SOURCE_HPP_
+#define RCSWITCHTRANSMITTER_TX_PAYLOAD_SOURCE_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace RcSwitchTx {
+
+/**
+ * Interface for a payload that is pulled bit by bit while a frame is being
+ * transmitted. Use this instead of a fixed array of double words, if the payload
+ * contains parts that are computed, like counters or checksums.
+ *
+ * The transmitter calls rewind() before each repetition of the frame, then
+ * nextBit() bitCount() times, and finally commit() once after the last repetition.
+ */
+class TxPayloadSource {
+public:
+  /** The number of bits of a frame. */
+  virtual size_t bitCount() const = 0;
+
+  /** Start over with the first bit of the frame. */
+  virtual void rewind() = 0;
+
+  /** Returns the next bit of the frame. Bits are delivered most significant first. */
+  virtual bool nextBit() = 0;
+
+  /** All repetitions of the frame have been sent. */
+  virtual void commit() {}
+
+protected:
+  ~TxPayloadSource() {}
+};
+
+/**
+ * Delivers an array of double words with the same semantics as
+ * RcSwitchTransmitter::send(protocolIndex, dwords, bitCount).
+ */
+class TxDwordSource : public TxPayloadSource {
+  const uint32_t* mDwords;
+  size_t mBitCount;
+  size_t mIndex;
+  size_t mBitPos;
+public:
+  TxDwordSource(const uint32_t* const dwords, const size_t bitCount);
+
+  size_t bitCount() const override {return mBitCount;}
+  void rewind() override;
+  bool nextBit() override;
+};
+
+/**
+ * Base class for a source that delivers the bits of another source followed by a
+ * trailer, which is computed on the fly from the delivered bits.
+ */
+class TxTrailerSource : public TxPayloadSource {
+  TxPayloadSource& mPayload;
+  size_t mTrailerBitCount;
+  size_t mPos;
+
+protected:
+  TxTrailerSource(TxPayloadSource& payload, const size_t trailerBitCount);
+
+  /** Reset the trailer computation. */
+  virtual void restart() = 0;
+
+  /** Feed the trailer computation with the next payload bit. */
+  virtual void feed(const bool bit) = 0;
+
+  /** The computed trailer. The trailerBitCount low significant bits are sent. */
+  virtual uint32_t trailer() const = 0;
+
+public:
+  size_t bitCount() const override {return mPayload.bitCount() + mTrailerBitCount;}
+  void rewind() override;
+  bool nextBit() override;
+  void commit() override {mPayload.commit();}
+};
+
+/**
+ * Appends a counter with counterBitCount bits (1 to 32) to the payload. Other bit
+ * counts are clamped to this range.
+ * The counter is incremented after all repetitions of a frame have been sent.
+ */
+class TxCounterSource : public TxTrailerSource {
+  uint32_t mCounter;
+  uint32_t mMask;
+
+  void restart() override {}
+  void feed(const bool) override {}
+  uint32_t trailer() const override {return mCounter;}
+
+public:
+  TxCounterSource(TxPayloadSource& payload, const size_t counterBitCount, const uint32_t startValue = 0);
+
+  uint32_t counter() const {return mCounter;}
+  void setCounter(const uint32_t value) {mCounter = value & mMask;}
+  void commit() override;
+};
+
+/**
+ * Appends a CRC with crcBitCount bits (1 to 16, otherwise clamped) over the payload. The CRC is
+ * computed bit by bit, most significant bit first, without reflection and
+ * without final XOR.
+ */
+class TxCrcSource : public TxTrailerSource {
+  uint16_t mMask;
+  uint16_t mTopBit;
+  uint16_t mPolynomial;
+  uint16_t mInit;
+  uint16_t mCrc;
+
+  void restart() override {mCrc = mInit;}
+  void feed(const bool bit) override;
+  uint32_t trailer() const override {return mCrc;}
+
+public:
+  TxCrcSource(TxPayloadSource& payload, const size_t crcBitCount, const uint16_t polynomial,
+      const uint16_t init);
+};
+
+/** CRC-8 trailer, default is polynomial x^8 + x^2 + x + 1 (CRC-8/SMBUS). */
+class TxCrc8Source : public TxCrcSource {
+public:
+  TxCrc8Source(TxPayloadSource& payload, const uint8_t polynomial = 0x07, const uint8_t init = 0x00)
+    : TxCrcSource(payload, 8, polynomial, init) {
+  }
+};
+
+/** CRC-16 trailer, default is polynomial x^16 + x^12 + x^5 + 1 (CRC-16/CCITT-FALSE). */
+class TxCrc16Source : public TxCrcSource {
+public:
+  TxCrc16Source(TxPayloadSource& payload, const uint16_t polynomial = 0x1021, const uint16_t init = 0xFFFF)
+    : TxCrcSource(payload, 16, polynomial, init) {
+  }
+};
+
+/**
+ * Appends an XOR checksum over the payload. The payload is split into chunks of
+ * checksumBitCount bits (1 to 32, otherwise clamped) and all chunks are XORed. If the payload bit
+ * count is not a multiple of checksumBitCount, the bits of the last chunk are
+ * taken as its low significant bits.
+ */
+class TxXorChecksumSource : public TxTrailerSource {
+  size_t mChunkBitCount;
+  size_t mChunkPos;
+  uint32_t mChunk;
+  uint32_t mChecksum;
+
+  void restart() override;
+  void feed(const bool bit) override;
+  uint32_t trailer() const override {return mChecksum ^ mChunk;}
+
+public:
+  TxXorChecksumSource(TxPayloadSource& payload, const size_t checksumBitCount = 8);
+};
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCHTRANSMITTER_TX_PAYLOAD_SOURCE_HPP_ */
@@ -23,13 +23,8 @@
 */
 
 #include "RcSwitchTransmitterBase.hpp"
-
-#if defined(ARDUINO_ARCH_SAM)
-// use own microseconds delay on ARDUINO_ARCH_SAM, because global delayMicroseconds() is causing problems.
-#define RCSWITCH_TRANSMITTER_USE_LOCAL_DELAY_MICROS true
-#else
-#define RCSWITCH_TRANSMITTER_USE_LOCAL_DELAY_MICROS false
-#endif
+#include "TxDelay.hpp"
+#include "TxFrameEncoder.hpp"
 
 #if not RCSWITCH_TRANSMITTER_USE_LOCAL_DELAY_MICROS
 #include <Arduino.h>
@@ -37,18 +32,37 @@
 #undef max
 #endif
 
-#if not RCSWITCH_TRANSMITTER_TIMING_CORRECTION
-#if defined (ARDUINO_AVR_UNO)
-  // We need to shorten the delay on UNO, because of its delayMicroseconds() function shifts the pulses
-  // length beyond tolerance.
-  #define RCSWITCH_TRANSMITTER_TIMING_CORRECTION (40) // usec
-#else
-  #define RCSWITCH_TRANSMITTER_TIMING_CORRECTION (0)  // usec
+#if not defined(RCSWITCH_TRANSMITTER_LOW_POWER_DELAY)
+// Set to true, to let the CPU idle during long pulses instead of busy waiting.
+#define RCSWITCH_TRANSMITTER_LOW_POWER_DELAY false
+#endif
+
+// A core may define its own RCSWITCH_TRANSMITTER_IDLE(), e.g. one that arms a timer
+// compare interrupt, as long as the CPU wakes up within RCSWITCH_TRANSMITTER_IDLE_WAKEUP_USEC.
+#if RCSWITCH_TRANSMITTER_LOW_POWER_DELAY && not defined(RCSWITCH_TRANSMITTER_IDLE)
+#if defined(__AVR__)
+  // The CPU is woken up by the timer 0 overflow interrupt, that drives millis() every 1024 usec at 16Mhz.
+  #include <avr/sleep.h>
+  #define RCSWITCH_TRANSMITTER_IDLE() do {set_sleep_mode(SLEEP_MODE_IDLE); sleep_mode();} while(false)
+#elif defined(__arm__) && (defined(ARDUINO_ARCH_SAM) || defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_STM32))
+  // The CPU is woken up by the SysTick interrupt, that drives millis() every 1000 usec.
+  // Other ARM cores (e.g. mbed or FreeRTOS based ones) may run tickless and aren't listed,
+  // because wfi could then sleep beyond the end of the pulse.
+  #define RCSWITCH_TRANSMITTER_IDLE() __asm__ volatile("wfi")
+#endif
 #endif
+
+#if not defined(RCSWITCH_TRANSMITTER_IDLE_WAKEUP_USEC)
+// The maximum time between 2 interrupts, that wake up the CPU from idle, plus a margin.
+#define RCSWITCH_TRANSMITTER_IDLE_WAKEUP_USEC 1200
 #endif
 
 namespace RcSwitchTx {
 
+void checkDurationConfiguration(TxDurationConfiguration<RCSWITCH_TRANSMITTER_TICKS_PER_USEC,
+    sizeof(tx_duration_t)>) {
+}
+
 void computeWhitening(uint8_t* inOut, const size_t bitCount) {
   const size_t remainingBits = bitCount % (8 * sizeof(*inOut));
   uint8_t WhiteningKeyMSB = 0x01;
@@ -73,67 +87,222 @@ void computeWhitening(uint8_t* out, const uint8_t* in, const size_t bitCount) {
   computeWhitening(out, bitCount);
 }
 
-inline void delayMicros(uint32_t) __attribute__((always_inline, unused));
-
-#if RCSWITCH_TRANSMITTER_USE_LOCAL_DELAY_MICROS
-
-inline void delayMicros(const uint32_t usec) {
+#if defined(RCSWITCH_TRANSMITTER_IDLE)
+/**
+ * Let the CPU idle until the remaining time is shorter than the time to the next
+ * wake up interrupt. Then busy wait the remaining time to keep the pulse accurate.
+ */
+inline void delayPulse(const uint32_t usec) {
   const uint32_t start = micros();
   while(true) {
-    const uint32_t delta = micros() - start;
-    if(delta >= usec) {
+    const uint32_t elapsed = micros() - start;
+    if(elapsed >= usec) {
       break;
     }
+    const uint32_t remaining = usec - elapsed;
+    if(remaining <= RCSWITCH_TRANSMITTER_IDLE_WAKEUP_USEC) {
+      delayMicros(remaining);
+      break;
+    }
+    RCSWITCH_TRANSMITTER_IDLE();
   }
 }
-
 #else
-  inline void delayMicros(const uint32_t usec) {
-    ::delayMicroseconds(usec);
-  }
+inline void delayPulse(const uint32_t usec) {
+  delayMicros(usec);
+}
 #endif
 
-void RcSwitchTransmitterBase::transmitBit(const int ioPin, const RcSwitchTx::TxTimingSpec &timingSpec,
-    const RcSwitchTx::TxPulsePairTime &pulsePairTime) {
+namespace {
+
+/**
+ * Frame encoder emitter, that puts the pulse pairs out on an IO pin.
+ */
+class TxPinEmitter {
+  const int mIoPin;
+  tx_duration_t mTicksCarry;
+
+  inline void delayTicks(const tx_duration_t ticks) {
+    // Carry the fraction of a microsecond over to the next pulse, so that the
+    // rounding errors don't accumulate.
+    const uint32_t ticksTotal = static_cast<uint32_t>(ticks) + mTicksCarry
+        - RCSWITCH_TRANSMITTER_TIMING_CORRECTION * TICKS_PER_USEC;
+    delayPulse(ticksTotal / TICKS_PER_USEC);
+    mTicksCarry = ticksTotal % TICKS_PER_USEC;
+  }
 
-  const unsigned logicLevelA = (timingSpec.bInverseLevel) ? LOW : HIGH;
-  const unsigned logicLevelB = (timingSpec.bInverseLevel) ? HIGH : LOW;
-  digitalWrite(ioPin, logicLevelA);
-  delayMicros(pulsePairTime.durationA - RCSWITCH_TRANSMITTER_TIMING_CORRECTION);
-  digitalWrite(ioPin, logicLevelB);
-  delayMicros(pulsePairTime.durationB - RCSWITCH_TRANSMITTER_TIMING_CORRECTION);
+public:
+  TxPinEmitter(const int ioPin) : mIoPin(ioPin), mTicksCarry(0) {}
+
+  inline void emit(const RcSwitchTx::TxTimingSpec &timingSpec,
+      const RcSwitchTx::TxPulsePairTime &pulsePairTime) {
+    const unsigned logicLevelA = (timingSpec.bInverseLevel) ? LOW : HIGH;
+    const unsigned logicLevelB = (timingSpec.bInverseLevel) ? HIGH : LOW;
+    digitalWrite(mIoPin, logicLevelA);
+    delayTicks(pulsePairTime.durationA);
+    digitalWrite(mIoPin, logicLevelB);
+    delayTicks(pulsePairTime.durationB);
+  }
+};
+
+} // anonymous name space
+
+void TxPowerControl::begin() {
+  pinMode(mEnablePin, OUTPUT);
+  powerDown();
+}
+
+void TxPowerControl::powerUp() {
+  if(not mEnabled) {
+    digitalWrite(mEnablePin, HIGH);
+    mEnabled = true;
+    delayPulse(mWarmUpUsec);
+  }
+}
+
+void TxPowerControl::releasePower() {
+  mLastTxMsec = millis();
+  if(mIdleTimeoutMsec == 0) {
+    powerDown();
+  }
+}
+
+void TxPowerControl::powerDown() {
+  digitalWrite(mEnablePin, LOW);
+  mEnabled = false;
+}
+
+void TxPowerControl::handleIdle() {
+  if(mEnabled && static_cast<uint32_t>(millis() - mLastTxMsec) >= mIdleTimeoutMsec) {
+    powerDown();
+  }
 }
 
 RESULT RcSwitchTransmitterBase::send(const int ioPin, const size_t protocolIndex,
     const uint32_t* const dwords, const size_t totalBitCount) {
-  if (mTxTimingSpecTable.start != nullptr) {
-    if (protocolIndex < mTxTimingSpecTable.size) {
-      const RcSwitchTx::TxTimingSpec &timingSpec = mTxTimingSpecTable.start[protocolIndex];
-      const size_t remainingBits = totalBitCount % (8 * sizeof(*dwords));
+  return send(ioPin, protocolIndex, dwords, totalBitCount, repeatCount());
+}
+
+RESULT RcSwitchTransmitterBase::send(const int ioPin, const size_t protocolIndex,
+    const uint32_t* const dwords, const size_t totalBitCount, const size_t repeatCount) {
+  if (timingSpecTable().start != nullptr) {
+    if (protocolIndex < timingSpecTable().size) {
+      const RcSwitchTx::TxTimingSpec &timingSpec = timingSpecTable().start[protocolIndex];
+      TxPinEmitter emitter(ioPin);
+      powerUp();
+      encodeFrame(emitter, timingSpec, dwords, totalBitCount, repeatCount);
+      releasePower();
+      return OK;
+    }
+  }
+  return INIT_ERR;
+}
+
+RESULT RcSwitchTransmitterBase::send(const int ioPin, const size_t protocolIndex,
+    TxPayloadSource& payload) {
+  if (timingSpecTable().start != nullptr) {
+    if (protocolIndex < timingSpecTable().size) {
+      const RcSwitchTx::TxTimingSpec &timingSpec = timingSpecTable().start[protocolIndex];
+      TxPinEmitter emitter(ioPin);
+      powerUp();
 
       // Send synch at the beginning of the first repetition
-      transmitBit(ioPin, timingSpec, timingSpec.synchronizationPulsePair);
-
-      for (size_t repeat = 0; repeat < mRepeatCount; repeat++) {
-        const size_t dwordCount = (totalBitCount + 8 * sizeof(*dwords) - 1) / (8 * sizeof(*dwords));
-        for(size_t index = 0; index < dwordCount; index++) {
-
-//          const size_t bitCount = index || not remainingBits ? 8 * sizeof(*dwords) : remainingBits;
-
-          const size_t bitCount = ((index + 1) < dwordCount) || not remainingBits ? 8 * sizeof(*dwords) : remainingBits;
-          for (size_t bitPos = bitCount; bitPos > 0;) {
-            --bitPos;
-            if (dwords[index] & (1L << bitPos)) {
-              transmitBit(ioPin, timingSpec, timingSpec.data1pulsePair);
-            } else {
-              transmitBit(ioPin, timingSpec, timingSpec.data0pulsePair);
-            }
-          }
-        }
+      emitter.emit(timingSpec, timingSpec.synchronizationPulsePair);
+
+      for (size_t repeat = 0; repeat < repeatCount(); repeat++) {
+        encodePayload(emitter, timingSpec, payload);
 
         // Send synch at the end of each repetition
-        transmitBit(ioPin, timingSpec, timingSpec.synchronizationPulsePair);
+        emitter.emit(timingSpec, timingSpec.synchronizationPulsePair);
+      }
+      releasePower();
+      payload.commit();
+      return OK;
+    }
+  }
+  return INIT_ERR;
+}
+
+RESULT RcSwitchTransmitterBase::send(const int ioPin, const size_t protocolIndex,
+    const uint32_t* const dwords, const size_t totalBitCount, TxLoopback& loopback,
+    TxLoopbackReport& report) {
+  if (timingSpecTable().start != nullptr) {
+    if (protocolIndex < timingSpecTable().size) {
+      const RcSwitchTx::TxTimingSpec &timingSpec = timingSpecTable().start[protocolIndex];
+      TxPinEmitter emitter(ioPin);
+      powerUp();
+      loopback.arm();
+      encodeFrame(emitter, timingSpec, dwords, totalBitCount, repeatCount());
+      loopback.disarm();
+      releasePower();
+      return loopback.verify(timingSpec, dwords, totalBitCount, repeatCount(), report) ? OK : LOOPBACK_ERR;
+    }
+  }
+  return INIT_ERR;
+}
+
+RESULT RcSwitchTransmitterBase::sendBurst(const int ioPin, const TxBurstEntry* const entries,
+    const size_t entryCount) {
+  if (timingSpecTable().start != nullptr) {
+    // Validate all entries up front, so that a bad entry doesn't leave a partially sent burst.
+    for (size_t i = 0; i < entryCount; i++) {
+      if (not (entries[i].protocolIndex < timingSpecTable().size)
+          || entries[i].bitCount > 8 * sizeof(entries[i].code)) {
+        return INIT_ERR;
+      }
+    }
+
+    // Repetitions of the different codes are interleaved, so that each receiver sees
+    // its repetitions spaced apart by the frames of the other codes.
+    TxPinEmitter emitter(ioPin);
+    powerUp();
+    const RcSwitchTx::TxTimingSpec* previousTimingSpec = nullptr;
+    for (size_t repeat = 0; repeat < repeatCount(); repeat++) {
+      for (size_t i = 0; i < entryCount; i++) {
+        const RcSwitchTx::TxTimingSpec &timingSpec = timingSpecTable().start[entries[i].protocolIndex];
+
+        // The synch at the end of the previous frame is shared as the leading synch
+        // of this frame, if both frames are of the same protocol.
+        if (previousTimingSpec != &timingSpec) {
+          emitter.emit(timingSpec, timingSpec.synchronizationPulsePair);
+        }
+        encodeDwords(emitter, timingSpec, &entries[i].code, entries[i].bitCount);
+
+        // Send synch at the end of each frame
+        emitter.emit(timingSpec, timingSpec.synchronizationPulsePair);
+        previousTimingSpec = &timingSpec;
       }
+    }
+    releasePower();
+    return OK;
+  }
+  return INIT_ERR;
+}
+
+RESULT RcSwitchTransmitterBase::sendStatic(const int ioPin, const tx_static_sender_t* const senders,
+    const size_t senderCount, const size_t protocolIndex, const uint32_t* const dwords,
+    const size_t totalBitCount) {
+  if (protocolIndex < senderCount) {
+    powerUp();
+    senders[protocolIndex](ioPin, dwords, totalBitCount, repeatCount());
+    releasePower();
+    return OK;
+  }
+  return INIT_ERR;
+}
+
+RESULT RcSwitchTransmitterBase::trace(Debug::serial_t &serial, const size_t protocolIndex,
+    const uint32_t* const dwords, const size_t totalBitCount, const TX_TRACE_FORMAT format) {
+  return trace(serial, protocolIndex, dwords, totalBitCount, repeatCount(), format);
+}
+
+RESULT RcSwitchTransmitterBase::trace(Debug::serial_t &serial, const size_t protocolIndex,
+    const uint32_t* const dwords, const size_t totalBitCount, const size_t repeatCount,
+    const TX_TRACE_FORMAT format) {
+  if (timingSpecTable().start != nullptr) {
+    if (protocolIndex < timingSpecTable().size) {
+      Debug::traceFrame(serial, timingSpecTable().start[protocolIndex], dwords, totalBitCount,
+          repeatCount, format);
       return OK;
     }
   }
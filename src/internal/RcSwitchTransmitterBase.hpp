@@ -26,6 +26,9 @@
 
 template<typename T, typename ...R> struct TxProtocolTable;
 #include "TxProtocolTimingSpec.hpp"
+#include "../TxPayloadSource.hpp"
+#include "TxTrace.hpp"
+#include "../TxLoopback.hpp"
 
 #ifndef RCSWITCH_TRANSMITTER_INTERNAL_RCSWITCHTRANSMITTERBASE_HPP_
 #define RCSWITCH_TRANSMITTER_INTERNAL_RCSWITCHTRANSMITTERBASE_HPP_
@@ -35,34 +38,166 @@ namespace RcSwitchTx {
 enum RESULT {
     INIT_ERR = -1,   // begin() function was not called.
     OK,              // send() function successfully executed.
-    BUSY             // still busy sending code from a previous send() call.
+    BUSY,            // still busy sending code from a previous send() call.
+    LOOPBACK_ERR     // send() with loopback: the frame was sent, but no edge has been captured.
 };
 
+/**
+ * Function, that sends a complete frame with the timing of one particular protocol.
+ * See TxStaticEmitter.hpp
+ */
+typedef void (*tx_static_sender_t)(const int ioPin, const uint32_t* const dwords,
+    const size_t totalBitCount, const size_t repeatCount);
+
+/**
+ * One frame of a burst. See RcSwitchTransmitter::sendBurst().
+ */
+struct TxBurstEntry {
+  size_t protocolIndex;
+  uint32_t code;
+  size_t bitCount; // Must not exceed 32. Otherwise the burst is rejected.
+};
 
-class RcSwitchTransmitterBase {
-private:
 
+/**
+ * The protocol table and the repeat count. A registry can be shared by multiple
+ * transmitters, which then hold just a pointer to it.
+ */
+class TxProtocolRegistry {
   RcSwitchTx::TxTimingSpecTable mTxTimingSpecTable;
   size_t mRepeatCount;
 
-  void transmitBit(const int ioPin,
-      const RcSwitchTx::TxTimingSpec &timingSpec,
-      const RcSwitchTx::TxPulsePairTime &pulsePairTime);
+public:
+  static constexpr size_t DEFAULT_REPEAT_CNT = 3;
 
-protected:
-  RcSwitchTransmitterBase(const size_t repeatCnt) : mTxTimingSpecTable{nullptr,0}, mRepeatCount(repeatCnt) {
+  constexpr TxProtocolRegistry() : mTxTimingSpecTable{nullptr,0}, mRepeatCount(DEFAULT_REPEAT_CNT) {
   }
 
-  void begin( const RcSwitchTx::TxTimingSpecTable& txTimingSpecTable) {
-     mTxTimingSpecTable = txTimingSpecTable;
+  void begin(const RcSwitchTx::TxTimingSpecTable& txTimingSpecTable) {
+    mTxTimingSpecTable = txTimingSpecTable;
   }
 
   inline void setRepeatCount(const size_t repeatCount) {
     mRepeatCount = repeatCount;
   }
 
+  inline const RcSwitchTx::TxTimingSpecTable& timingSpecTable() const {
+    return mTxTimingSpecTable;
+  }
+
+  inline size_t repeatCount() const {
+    return mRepeatCount;
+  }
+};
+
+/**
+ * Switches a transmitter module on and off by its enable pin.
+ */
+class TxPowerControl {
+  int mEnablePin;
+  bool mEnabled;
+  uint32_t mWarmUpUsec;
+  uint32_t mIdleTimeoutMsec;
+  uint32_t mLastTxMsec;
+
+public:
+  static constexpr uint32_t DEFAULT_WARM_UP_USEC = 1000;
+
+  TxPowerControl(const int enablePin, const uint32_t warmUpUsec = DEFAULT_WARM_UP_USEC,
+      const uint32_t idleTimeoutMsec = 0) : mEnablePin(enablePin), mEnabled(false),
+      mWarmUpUsec(warmUpUsec), mIdleTimeoutMsec(idleTimeoutMsec), mLastTxMsec(0) {
+  }
+
+  /** Set up the pin mode and disable the module. */
+  void begin();
+
+  /** Enable the module and wait for the warm up time, if it is not enabled yet. */
+  void powerUp();
+
+  /** Start the idle timeout. */
+  void releasePower();
+
+  /** Disable the module immediately. */
+  void powerDown();
+
+  /** Disable the module, if the idle timeout has elapsed. */
+  void handleIdle();
+};
+
+/**
+ * The emit core, that is shared by all RcSwitchTransmitter instances regardless
+ * of their IO pin.
+ */
+class RcSwitchTransmitterBase {
+private:
+  TxProtocolRegistry* mRegistry;  // nullptr until begin() is called.
+  TxPowerControl* mPowerControl;
+
+  inline TxTimingSpecTable timingSpecTable() const {
+    return mRegistry ? mRegistry->timingSpecTable() : TxTimingSpecTable{nullptr, 0};
+  }
+
+  inline void powerUp() {
+    if(mPowerControl) {
+      mPowerControl->powerUp();
+    }
+  }
+
+  inline void releasePower() {
+    if(mPowerControl) {
+      mPowerControl->releasePower();
+    }
+  }
+
+protected:
+  RcSwitchTransmitterBase() : mRegistry(nullptr), mPowerControl(nullptr) {
+  }
+
+  void begin(TxProtocolRegistry& registry) {
+    checkDurationConfiguration(TxDurationConfiguration<RCSWITCH_TRANSMITTER_TICKS_PER_USEC,
+        sizeof(tx_duration_t)>());
+    mRegistry = &registry;
+  }
+
+  inline void setRepeatCount(const size_t repeatCount) {
+    if(mRegistry) {
+      mRegistry->setRepeatCount(repeatCount);
+    }
+  }
+
+  inline size_t repeatCount() const {
+    if(mRegistry) {
+      return mRegistry->repeatCount();
+    }
+    return TxProtocolRegistry::DEFAULT_REPEAT_CNT;
+  }
+
+  inline void setPowerControl(TxPowerControl& powerControl) {
+    mPowerControl = &powerControl;
+    mPowerControl->begin();
+  }
+
   RESULT send(const int ioPin, const size_t protocolIndex, const uint32_t* const dwords,
       const size_t totalBitCount);
+
+  RESULT send(const int ioPin, const size_t protocolIndex, const uint32_t* const dwords,
+      const size_t totalBitCount, const size_t repeatCount);
+
+  RESULT send(const int ioPin, const size_t protocolIndex, TxPayloadSource& payload);
+
+  RESULT send(const int ioPin, const size_t protocolIndex, const uint32_t* const dwords,
+      const size_t totalBitCount, TxLoopback& loopback, TxLoopbackReport& report);
+
+  RESULT sendBurst(const int ioPin, const TxBurstEntry* const entries, const size_t entryCount);
+
+  RESULT sendStatic(const int ioPin, const tx_static_sender_t* const senders, const size_t senderCount,
+      const size_t protocolIndex, const uint32_t* const dwords, const size_t totalBitCount);
+
+  RESULT trace(Debug::serial_t &serial, const size_t protocolIndex, const uint32_t* const dwords,
+      const size_t totalBitCount, const TX_TRACE_FORMAT format);
+
+  RESULT trace(Debug::serial_t &serial, const size_t protocolIndex, const uint32_t* const dwords,
+      const size_t totalBitCount, const size_t repeatCount, const TX_TRACE_FORMAT format);
 };
 
 } // namespace RcSwitchTx
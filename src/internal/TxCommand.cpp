@@ -0,0 +1,156 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "../TxCommand.hpp"
+
+namespace RcSwitchTx {
+
+namespace {
+
+// Number of data bytes for the given bit count.
+size_t dataByteCount(const size_t bitCount) {
+  const size_t remainingBits = bitCount % 32;
+  return 4 * (bitCount / 32) + (remainingBits + 7) / 8;
+}
+
+} // anonymous namespace
+
+uint8_t txCommandCrc8(uint8_t crc, const uint8_t byte) {
+  crc ^= byte;
+  for (size_t i = 0; i < 8; i++) {
+    crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+  }
+  return crc;
+}
+
+size_t encodeTxCommand(uint8_t* const buffer, const size_t bufferSize, const uint8_t seq,
+    const uint8_t command, const uint8_t* const payload, const size_t length) {
+  const size_t frameSize = 5 + length;
+  if (length > TX_COMMAND_MAX_PAYLOAD || frameSize > bufferSize) {
+    return 0;
+  }
+  buffer[0] = TX_COMMAND_SOF;
+  buffer[1] = static_cast<uint8_t>(length);
+  buffer[2] = seq;
+  buffer[3] = command;
+  uint8_t crc = 0;
+  for (size_t i = 1; i < 4; i++) {
+    crc = txCommandCrc8(crc, buffer[i]);
+  }
+  for (size_t i = 0; i < length; i++) {
+    buffer[4 + i] = payload[i];
+    crc = txCommandCrc8(crc, payload[i]);
+  }
+  buffer[4 + length] = crc;
+  return frameSize;
+}
+
+size_t encodeTxSendCommand(uint8_t* const buffer, const size_t bufferSize, const uint8_t seq,
+    const uint8_t protocolIndex, const uint8_t repeatCount, const uint32_t* const dwords,
+    const size_t bitCount) {
+  if (bitCount == 0 || bitCount > RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS) {
+    return 0;
+  }
+  uint8_t payload[TX_COMMAND_MAX_PAYLOAD];
+  payload[0] = protocolIndex;
+  payload[1] = repeatCount;
+  payload[2] = static_cast<uint8_t>(bitCount);
+  const size_t byteCount = dataByteCount(bitCount);
+  for (size_t i = 0; i < byteCount; i++) {
+    // Byte i counts from the most significant byte of its double word. The last
+    // double word only has as many bytes, as needed for its remaining bits.
+    const size_t index = i / 4;
+    const size_t bytesInDword = (index + 1) * 4 <= byteCount ? 4 : byteCount - index * 4;
+    const size_t shift = 8 * (bytesInDword - 1 - i % 4);
+    payload[3 + i] = static_cast<uint8_t>(dwords[index] >> shift);
+  }
+  return encodeTxCommand(buffer, bufferSize, seq, TX_COMMAND_SEND, payload, 3 + byteCount);
+}
+
+bool decodeTxSendCommand(const TxCommandFrame& frame, TxSendCommand& sendCommand) {
+  if (frame.length < 3) {
+    return false;
+  }
+  const size_t bitCount = frame.payload[2];
+  if (bitCount == 0 || bitCount > RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS
+      || frame.length != 3 + dataByteCount(bitCount)) {
+    return false;
+  }
+  sendCommand.protocolIndex = frame.payload[0];
+  sendCommand.repeatCount = frame.payload[1];
+  sendCommand.bitCount = static_cast<uint8_t>(bitCount);
+  for (size_t index = 0; index < TX_COMMAND_MAX_DWORDS; index++) {
+    sendCommand.dwords[index] = 0;
+  }
+  for (size_t i = 3; i < frame.length; i++) {
+    const size_t index = (i - 3) / 4;
+    sendCommand.dwords[index] = (sendCommand.dwords[index] << 8) | frame.payload[i];
+  }
+  return true;
+}
+
+TxCommandDecoder::RESULT TxCommandDecoder::feed(const uint8_t byte) {
+  switch (mState) {
+  case WAIT_SOF:
+    if (byte == TX_COMMAND_SOF) {
+      mCrc = 0;
+      mState = WAIT_LENGTH;
+    }
+    break;
+  case WAIT_LENGTH:
+    if (byte > TX_COMMAND_MAX_PAYLOAD) {
+      // Can't be a frame. Resynchronize on the next SOF.
+      mState = byte == TX_COMMAND_SOF ? WAIT_LENGTH : WAIT_SOF;
+      break;
+    }
+    mCrc = txCommandCrc8(mCrc, byte);
+    mFrame.length = byte;
+    mState = WAIT_SEQ;
+    break;
+  case WAIT_SEQ:
+    mCrc = txCommandCrc8(mCrc, byte);
+    mFrame.seq = byte;
+    mState = WAIT_COMMAND;
+    break;
+  case WAIT_COMMAND:
+    mCrc = txCommandCrc8(mCrc, byte);
+    mFrame.command = byte;
+    mIndex = 0;
+    mState = mFrame.length ? WAIT_PAYLOAD : WAIT_CRC;
+    break;
+  case WAIT_PAYLOAD:
+    mCrc = txCommandCrc8(mCrc, byte);
+    mFrame.payload[mIndex++] = byte;
+    if (mIndex == mFrame.length) {
+      mState = WAIT_CRC;
+    }
+    break;
+  case WAIT_CRC:
+    mState = WAIT_SOF;
+    return byte == mCrc ? COMPLETE : CRC_ERR;
+  }
+  return PENDING;
+}
+
+} // namespace RcSwitchTx
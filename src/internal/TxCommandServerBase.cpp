@@ -0,0 +1,134 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "TxCommandServerBase.hpp"
+
+namespace RcSwitchTx {
+
+void checkCommandConfiguration(TxCommandConfiguration<RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE,
+    RCSWITCH_TRANSMITTER_COMMAND_SEQ_HISTORY, RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS>) {
+}
+
+void TxCommandServerBase::respond(const uint8_t seq, const TX_COMMAND command,
+    const TX_COMMAND_STATUS status) {
+  const uint8_t payload[] = {static_cast<uint8_t>(status), static_cast<uint8_t>(freeSlots())};
+  uint8_t buffer[5 + sizeof(payload)];
+  const size_t size = encodeTxCommand(buffer, sizeof(buffer), seq, command, payload, sizeof(payload));
+  mSerial.write(buffer, size);
+}
+
+bool TxCommandServerBase::isAccepted(const uint8_t seq) const {
+  for (size_t i = 0; i < mAcceptedSeqCount; i++) {
+    if (mAcceptedSeqs[i] == seq) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void TxCommandServerBase::accept(const uint8_t seq) {
+  mAcceptedSeqs[mAcceptedSeqNext] = seq;
+  mAcceptedSeqNext = (mAcceptedSeqNext + 1) % ACCEPTED_SEQ_COUNT;
+  if (mAcceptedSeqCount < ACCEPTED_SEQ_COUNT) {
+    mAcceptedSeqCount++;
+  }
+  mExpectedSeq = static_cast<uint8_t>(seq + 1);
+  mSynchronized = true;
+}
+
+void TxCommandServerBase::handleSend(const TxCommandFrame& frame) {
+  if (isAccepted(frame.seq)) {
+    // A resent command, whose response got lost. Don't send the code twice.
+    respond(frame.seq, TX_COMMAND_ACK, TX_COMMAND_OK);
+  } else if (mSynchronized && frame.seq != mExpectedSeq) {
+    respond(frame.seq, TX_COMMAND_NAK, TX_COMMAND_SEQUENCE);
+  } else if (mCount == RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE) {
+    respond(frame.seq, TX_COMMAND_NAK, TX_COMMAND_BUSY);
+  } else {
+    QueueEntry& entry = mQueue[(mHead + mCount) % RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE];
+    if (decodeTxSendCommand(frame, entry.command)) {
+      entry.seq = frame.seq;
+      mCount++;
+      accept(frame.seq);
+      respond(frame.seq, TX_COMMAND_ACK, TX_COMMAND_OK);
+    } else {
+      // Rejected for good. The host doesn't resend it, so don't wait for it.
+      mExpectedSeq = static_cast<uint8_t>(frame.seq + 1);
+      respond(frame.seq, TX_COMMAND_NAK, TX_COMMAND_INVALID);
+    }
+  }
+}
+
+void TxCommandServerBase::handleFrame(const TxCommandFrame& frame) {
+  mLastSeq = frame.seq;
+  switch (frame.command) {
+  case TX_COMMAND_SEND:
+    handleSend(frame);
+    break;
+  case TX_COMMAND_PING:
+    // A host starts a new sequence with a ping.
+    mAcceptedSeqCount = 0;
+    mExpectedSeq = static_cast<uint8_t>(frame.seq + 1);
+    mSynchronized = true;
+    respond(frame.seq, TX_COMMAND_ACK, TX_COMMAND_OK);
+    break;
+  default:
+    respond(frame.seq, TX_COMMAND_NAK, TX_COMMAND_INVALID);
+    break;
+  }
+}
+
+void TxCommandServerBase::receive() {
+  // Don't block sending by a continuous stream of received bytes. Process at most
+  // the bytes, that are available right now.
+  for (int available = mSerial.available(); available > 0; available--) {
+    const int byte = mSerial.read();
+    if (byte < 0) {
+      break;
+    }
+    switch (mDecoder.feed(static_cast<uint8_t>(byte))) {
+    case TxCommandDecoder::COMPLETE:
+      handleFrame(mDecoder.frame());
+      break;
+    case TxCommandDecoder::CRC_ERR:
+      respond(mLastSeq, TX_COMMAND_NAK, TX_COMMAND_CRC_ERR);
+      break;
+    case TxCommandDecoder::PENDING:
+      break;
+    }
+  }
+}
+
+void TxCommandServerBase::pop(const RESULT result) {
+  if (mCount) {
+    const uint8_t seq = mQueue[mHead].seq;
+    mHead = (mHead + 1) % RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE;
+    mCount--;
+    if (result != OK) {
+      respond(seq, TX_COMMAND_NAK, result == BUSY ? TX_COMMAND_BUSY : TX_COMMAND_INIT_ERR);
+    }
+  }
+}
+
+} // namespace RcSwitchTx
@@ -0,0 +1,124 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCHTRANSMITTER_INTERNAL_TX_COMMAND_SERVER_BASE_HPP_
+#define RCSWITCHTRANSMITTER_INTERNAL_TX_COMMAND_SERVER_BASE_HPP_
+
+#include <Arduino.h>
+#include "RcSwitchTransmitterBase.hpp"
+#include "../TxCommand.hpp"
+
+#if not defined(RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE)
+#if defined(__AVR__)
+  #define RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE 4   // send commands
+#else
+  #define RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE 16  // send commands
+#endif
+#endif
+
+#if not defined(RCSWITCH_TRANSMITTER_COMMAND_SEQ_HISTORY)
+  // Sent commands, that are still recognized as duplicates.
+  #define RCSWITCH_TRANSMITTER_COMMAND_SEQ_HISTORY 4  // send commands
+#endif
+
+namespace RcSwitchTx {
+
+/**
+ * The command configuration, that sizes the queue of TxCommandServerBase. Like
+ * TxDurationConfiguration, a sketch with another configuration than the library
+ * fails to link.
+ */
+template<unsigned long queueSize, unsigned long seqHistory, unsigned long maxBits>
+struct TxCommandConfiguration {};
+
+void checkCommandConfiguration(TxCommandConfiguration<RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE,
+    RCSWITCH_TRANSMITTER_COMMAND_SEQ_HISTORY, RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS>);
+
+/**
+ * The part of the command server, that doesn't depend on the IO pin of the
+ * transmitter.
+ */
+class TxCommandServerBase {
+public:
+  typedef typeof(Serial) serial_t;
+
+private:
+  struct QueueEntry {
+    uint8_t seq;
+    TxSendCommand command;
+  };
+
+  serial_t& mSerial;
+  TxCommandDecoder mDecoder;
+  QueueEntry mQueue[RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE];
+  size_t mHead;
+  size_t mCount;
+  uint8_t mLastSeq;
+
+  // The SEQs of the most recently accepted send commands, queued or already sent.
+  static constexpr size_t ACCEPTED_SEQ_COUNT =
+      RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE + RCSWITCH_TRANSMITTER_COMMAND_SEQ_HISTORY;
+  uint8_t mAcceptedSeqs[ACCEPTED_SEQ_COUNT];
+  size_t mAcceptedSeqCount;
+  size_t mAcceptedSeqNext;
+  uint8_t mExpectedSeq;
+  bool mSynchronized;     // mExpectedSeq is valid.
+
+  void respond(const uint8_t seq, const TX_COMMAND command, const TX_COMMAND_STATUS status);
+  void handleFrame(const TxCommandFrame& frame);
+  void handleSend(const TxCommandFrame& frame);
+  bool isAccepted(const uint8_t seq) const;
+  void accept(const uint8_t seq);
+
+protected:
+  TxCommandServerBase(serial_t& serial) : mSerial(serial), mDecoder(), mQueue(), mHead(0),
+    mCount(0), mLastSeq(0), mAcceptedSeqs(), mAcceptedSeqCount(0), mAcceptedSeqNext(0),
+    mExpectedSeq(0), mSynchronized(false) {
+    checkCommandConfiguration(TxCommandConfiguration<RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE,
+        RCSWITCH_TRANSMITTER_COMMAND_SEQ_HISTORY, RCSWITCH_TRANSMITTER_COMMAND_MAX_BITS>());
+  }
+
+  /** Decode the received bytes, queue the send commands and respond. */
+  void receive();
+
+  /** The oldest queued send command or nullptr, if the queue is empty. */
+  inline const TxSendCommand* front() const {
+    return mCount ? &mQueue[mHead].command : nullptr;
+  }
+
+  /** Remove the oldest queued send command. Respond, if it failed to send. */
+  void pop(const RESULT result);
+
+public:
+  /** The number of send commands, that can still be queued. */
+  inline size_t freeSlots() const {
+    return RCSWITCH_TRANSMITTER_COMMAND_QUEUE_SIZE - mCount;
+  }
+};
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCHTRANSMITTER_INTERNAL_TX_COMMAND_SERVER_BASE_HPP_ */
@@ -0,0 +1,71 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+
+#pragma once
+
+#ifndef RCSWITCH_TRANSMITTER_INTERNAL_DELAY_HPP_
+#define RCSWITCH_TRANSMITTER_INTERNAL_DELAY_HPP_
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#if defined(ARDUINO_ARCH_SAM)
+// use own microseconds delay on ARDUINO_ARCH_SAM, because global delayMicroseconds() is causing problems.
+#define RCSWITCH_TRANSMITTER_USE_LOCAL_DELAY_MICROS true
+#else
+#define RCSWITCH_TRANSMITTER_USE_LOCAL_DELAY_MICROS false
+#endif
+
+namespace RcSwitchTx {
+
+inline void delayMicros(uint32_t) __attribute__((always_inline, unused));
+
+#if RCSWITCH_TRANSMITTER_USE_LOCAL_DELAY_MICROS
+
+inline void delayMicros(const uint32_t usec) {
+  const uint32_t start = micros();
+  while(true) {
+    const uint32_t delta = micros() - start;
+    if(delta >= usec) {
+      break;
+    }
+  }
+}
+
+#else
+  inline void delayMicros(uint32_t usec) {
+    // delayMicroseconds() is accurate up to 16383 usec only.
+    constexpr uint32_t MAX_DELAY_MICROS = 16383;
+    while(usec > MAX_DELAY_MICROS) {
+      ::delayMicroseconds(MAX_DELAY_MICROS);
+      usec -= MAX_DELAY_MICROS;
+    }
+    ::delayMicroseconds(usec);
+  }
+#endif
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCH_TRANSMITTER_INTERNAL_DELAY_HPP_ */
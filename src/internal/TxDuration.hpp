@@ -0,0 +1,65 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCH_TRANSMITTER_INTERNAL_DURATION_HPP_
+#define RCSWITCH_TRANSMITTER_INTERNAL_DURATION_HPP_
+
+#include <stdint.h>
+
+#if not defined(RCSWITCH_TRANSMITTER_DURATION_TYPE)
+  // The type for pulse durations. Use uint32_t for pulses longer than 65535 ticks on AVR.
+  #define RCSWITCH_TRANSMITTER_DURATION_TYPE unsigned int
+#endif
+
+#if not defined(RCSWITCH_TRANSMITTER_TICKS_PER_USEC)
+  // The resolution of pulse durations. E.g. 4 for a resolution of 0.25 usec.
+  #define RCSWITCH_TRANSMITTER_TICKS_PER_USEC 1
+#endif
+
+namespace RcSwitchTx {
+
+typedef RCSWITCH_TRANSMITTER_DURATION_TYPE tx_duration_t;
+static_assert(static_cast<tx_duration_t>(-1) > 0, "RCSWITCH_TRANSMITTER_DURATION_TYPE must be unsigned.");
+
+static constexpr tx_duration_t TX_DURATION_MAX = static_cast<tx_duration_t>(-1);
+static constexpr tx_duration_t TICKS_PER_USEC = RCSWITCH_TRANSMITTER_TICKS_PER_USEC;
+
+/**
+ * The duration configuration, that the tables of a sketch are built with. It must
+ * match the one of the library .cpp files. Therefore checkDurationConfiguration()
+ * is defined in the library for its own configuration only. A sketch, that
+ * defines RCSWITCH_TRANSMITTER_TICKS_PER_USEC or RCSWITCH_TRANSMITTER_DURATION_TYPE
+ * differently, fails to link with an undefined reference to it.
+ */
+template<unsigned long ticksPerUsec, unsigned long durationSize>
+struct TxDurationConfiguration {};
+
+void checkDurationConfiguration(TxDurationConfiguration<RCSWITCH_TRANSMITTER_TICKS_PER_USEC,
+    sizeof(tx_duration_t)>);
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCH_TRANSMITTER_INTERNAL_DURATION_HPP_ */
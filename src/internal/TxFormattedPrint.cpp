@@ -22,12 +22,6 @@
   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
 */
 
-#include <stdlib.h>
-#if defined(ARDUINO_ARCH_SAM)
-  // Don't know why this is not in stdlib.h ?
-  #include <itoa.h>
-#endif
-
 #include "TxFormattedPrint.hpp"
 
 namespace RcSwitchTx {
@@ -40,7 +34,7 @@ uint32_t scaleUint32(const uint32_t value, unsigned int base) {
   return value;
 }
 
-size_t decimalDigits(unsigned int value) {
+size_t decimalDigits(uint32_t value) {
   size_t result = 0;
   do {
     ++result;
@@ -49,15 +43,57 @@ size_t decimalDigits(unsigned int value) {
   return result;
 }
 
-void sprintNumAsDecimal(char *string, const unsigned int value, const size_t width) {
-  const size_t digitCnt = decimalDigits(value);
-  const size_t spacesCnt = width > digitCnt ? width - digitCnt : 0;
+size_t formatDecimal(char *string, uint32_t value, const size_t width) {
+  // Generate the digits from the least significant one backwards.
+  char digits[NUMTOA_BUFFER_SIZE];
+  size_t digitCnt = 0;
+  do {
+    digits[digitCnt++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while(value > 0);
+
   size_t i = 0;
-  while(i < spacesCnt) {
-    string[i] = ' ';
-    ++i;
+  while(i + digitCnt < width) {
+    string[i++] = ' ';
+  }
+  while(digitCnt > 0) {
+    string[i++] = digits[--digitCnt];
+  }
+  return i;
+}
+
+void sprintNumAsDecimal(char *string, const uint32_t value, const size_t width) {
+  string[formatDecimal(string, value, width)] = '\0';
+}
+
+TxLineBuffer& TxLineBuffer::put(const char* string) {
+  while(*string) {
+    put(*string++);
+  }
+  return *this;
+}
+
+TxLineBuffer& TxLineBuffer::putDecimal64(uint64_t value) {
+  // Generate the digits from the least significant one backwards.
+  char digits[20];
+  size_t digitCnt = 0;
+  do {
+    digits[digitCnt++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while(value > 0);
+  while(digitCnt > 0) {
+    put(digits[--digitCnt]);
+  }
+  return *this;
+}
+
+TxLineBuffer& TxLineBuffer::putDecimal(const uint32_t value, const size_t width) {
+  char buffer[NUMTOA_BUFFER_SIZE];
+  const size_t length = formatDecimal(buffer, value, width < NUMTOA_BUFFER_SIZE ? width : 0);
+  for(size_t i = 0; i < length; i++) {
+    put(buffer[i]);
   }
-  itoa(value, &string[i], 10);
+  return *this;
 }
 
 } // namespace RcSwitch
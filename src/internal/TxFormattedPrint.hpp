@@ -33,30 +33,79 @@
 
 namespace RcSwitchTx {
 
-static constexpr size_t NUMTOA_BUFFER_SIZE = sizeof(size_t)*8+1;
+static constexpr size_t NUMTOA_BUFFER_SIZE = sizeof(uint32_t)*8+1;
+
+/**
+ * Writes an unsigned integer with a particular width in one pass. If the number
+ * has less decimal digits than width, the number is prepended with spaces.
+ * The string is not null terminated. Returns the number of characters written.
+ */
+size_t formatDecimal(char *string, uint32_t value, const size_t width);
 
 /**
  * Prints an unsigned integer with a particular width. If the the number less
  * has decimal digits than width, the number is prepended with spaces.
  */
-void sprintNumAsDecimal(char *string, const unsigned int value, const size_t width);
+void sprintNumAsDecimal(char *string, const uint32_t value, const size_t width);
 
 /**
  * Returns the number of decimal digits of an unsigned integer.
  */
-size_t decimalDigits(unsigned int value);
+size_t decimalDigits(uint32_t value);
 
 /**
  * Returns a base - rounded and divided 32 bit integer.
  */
 uint32_t scaleUint32(const uint32_t value, const unsigned int  base);
 
+/**
+ * Collects a line in a stack buffer, so that it is written to a stream with a
+ * single write(). Text, that exceeds the capacity, is cut off. The line break
+ * has its own room, so a line is always terminated.
+ */
+class TxLineBuffer {
+public:
+  static constexpr size_t CAPACITY = 96; // characters without the line break
+
+private:
+  static constexpr size_t LINE_BREAK_SIZE = 2;
+  char mBuffer[CAPACITY + LINE_BREAK_SIZE];
+  size_t mLength;
+
+public:
+  TxLineBuffer() : mLength(0) {}
+
+  inline TxLineBuffer& put(const char c) {
+    if(mLength < CAPACITY) {
+      mBuffer[mLength++] = c;
+    }
+    return *this;
+  }
+
+  TxLineBuffer& put(const char* string);
+
+  /** Append an unsigned integer, prepended with spaces up to width. */
+  TxLineBuffer& putDecimal(const uint32_t value, const size_t width = 0);
+
+  /** Append a 64 bit unsigned integer. */
+  TxLineBuffer& putDecimal64(uint64_t value);
+
+  /** Write the line followed by a line break and clear the buffer. */
+  template<typename T>
+  void writeLine(T& stream) {
+    mBuffer[mLength] = '\r';
+    mBuffer[mLength + 1] = '\n';
+    stream.write(reinterpret_cast<const uint8_t*>(mBuffer), mLength + LINE_BREAK_SIZE);
+    mLength = 0;
+  }
+};
+
 template<typename T>
 void printNumWithSeparator(T& stream, const unsigned int value, const size_t width, const char* separator) {
   char buffer[NUMTOA_BUFFER_SIZE];
   sprintNumAsDecimal(buffer, value, width);
   stream.print(buffer);
-  if(separator && strlen(separator)) {
+  if(separator && *separator) {
     stream.print(separator);
   } else {
     // Print a space as default separator.
@@ -69,11 +118,12 @@ void printNumWithUnitAndSeparator(T& stream, const unsigned int value, const siz
   char buffer[NUMTOA_BUFFER_SIZE];
   sprintNumAsDecimal(buffer, value, width);
   stream.print(buffer);
-  if(separator && strlen(separator)) {
+  const bool hasSeparator = separator && *separator;
+  if(hasSeparator) {
     stream.print(separator);
   }
   stream.print(unit);
-  if(separator && strlen(separator)) {
+  if(hasSeparator) {
     stream.print(separator);
   } else {
     // Print a space as default separator.
@@ -89,7 +139,7 @@ inline void printUsecWithSeparator(T& stream, const unsigned int value, const si
 template<typename T>
 void printStringWithSeparator(T& stream, const char* string, const char* separator) {
   stream.print(string);
-  if(separator && strlen(separator)) {
+  if(separator && *separator) {
     stream.print(separator);
   } else {
     // Print a space as default separator.
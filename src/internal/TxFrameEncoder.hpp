@@ -0,0 +1,104 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCH_TRANSMITTER_INTERNAL_FRAME_ENCODER_HPP_
+#define RCSWITCH_TRANSMITTER_INTERNAL_FRAME_ENCODER_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TxProtocolTimingSpec.hpp"
+#include "../TxPayloadSource.hpp"
+
+namespace RcSwitchTx {
+
+/**
+ * The frame encoder walks through the pulse pairs of a frame and hands each of them
+ * over to an emitter. The emitter decides what to do with a pulse pair, e.g. put it
+ * out on an IO pin or write it to a trace. An emitter must provide the function:
+ *
+ *   void emit(const TxTimingSpec& timingSpec, const TxPulsePairTime& pulsePair);
+ */
+
+/**
+ * Emit the data pulse pairs for an array of double words. If totalBitCount is not a
+ * multiple of 32, only the low significant bits of the last double word are emitted.
+ */
+template<typename EMITTER>
+void encodeDwords(EMITTER& emitter, const TxTimingSpec &timingSpec,
+    const uint32_t* const dwords, const size_t totalBitCount) {
+  const size_t remainingBits = totalBitCount % (8 * sizeof(*dwords));
+  const size_t dwordCount = (totalBitCount + 8 * sizeof(*dwords) - 1) / (8 * sizeof(*dwords));
+  for(size_t index = 0; index < dwordCount; index++) {
+    const size_t bitCount = ((index + 1) < dwordCount) || not remainingBits ? 8 * sizeof(*dwords) : remainingBits;
+    for (size_t bitPos = bitCount; bitPos > 0;) {
+      --bitPos;
+      if (dwords[index] & (static_cast<uint32_t>(1) << bitPos)) {
+        emitter.emit(timingSpec, timingSpec.data1pulsePair);
+      } else {
+        emitter.emit(timingSpec, timingSpec.data0pulsePair);
+      }
+    }
+  }
+}
+
+/**
+ * Emit the data pulse pairs for a payload source.
+ */
+template<typename EMITTER>
+void encodePayload(EMITTER& emitter, const TxTimingSpec &timingSpec, TxPayloadSource& payload) {
+  const size_t bitCount = payload.bitCount();
+  payload.rewind();
+  for (size_t i = 0; i < bitCount; i++) {
+    if (payload.nextBit()) {
+      emitter.emit(timingSpec, timingSpec.data1pulsePair);
+    } else {
+      emitter.emit(timingSpec, timingSpec.data0pulsePair);
+    }
+  }
+}
+
+/**
+ * Emit a complete frame: A leading synch followed by repeatCount repetitions
+ * of the data, each terminated by a synch.
+ */
+template<typename EMITTER>
+void encodeFrame(EMITTER& emitter, const TxTimingSpec &timingSpec,
+    const uint32_t* const dwords, const size_t totalBitCount, const size_t repeatCount) {
+  // Send synch at the beginning of the first repetition
+  emitter.emit(timingSpec, timingSpec.synchronizationPulsePair);
+
+  for (size_t repeat = 0; repeat < repeatCount; repeat++) {
+    encodeDwords(emitter, timingSpec, dwords, totalBitCount);
+
+    // Send synch at the end of each repetition
+    emitter.emit(timingSpec, timingSpec.synchronizationPulsePair);
+  }
+}
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCH_TRANSMITTER_INTERNAL_FRAME_ENCODER_HPP_ */
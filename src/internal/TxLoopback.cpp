@@ -0,0 +1,157 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "ISR_ATTR.hpp"
+#include "TxFormattedPrint.hpp"
+#include "TxFrameEncoder.hpp"
+#include "../TxLoopback.hpp"
+
+namespace {
+
+constexpr uint16_t MAX_PULSE_DURATION = 0xFFFF; // usec
+
+// The durations between consecutive pulse boundaries. The first one is measured
+// from the time of arming, so it is either the idle time before the first edge or,
+// if the first pulse had no leading edge, the first pulse itself.
+DATA_ISR_ATTR uint16_t pulses[RCSWITCH_TRANSMITTER_LOOPBACK_CAPACITY];
+DATA_ISR_ATTR volatile size_t pulseCount = 0;
+DATA_ISR_ATTR volatile bool pulseOverflow = false;
+DATA_ISR_ATTR uint32_t lastBoundary = 0;
+
+inline uint16_t saturatedDuration(const uint32_t usec) {
+  return usec > MAX_PULSE_DURATION ? MAX_PULSE_DURATION : static_cast<uint16_t>(usec);
+}
+
+TEXT_ISR_ATTR_0 void handleInterrupt() {
+  const uint32_t now = micros();
+  const size_t i = pulseCount;
+  if(i < RCSWITCH_TRANSMITTER_LOOPBACK_CAPACITY) {
+    pulses[i] = saturatedDuration(now - lastBoundary);
+    pulseCount = i + 1;
+  } else {
+    pulseOverflow = true;
+  }
+  lastBoundary = now;
+}
+
+/**
+ * Frame encoder emitter, that compares the expected pulses with the captured ones.
+ */
+class TxVerifyEmitter {
+  const unsigned int mPercentTolerance;
+  const size_t mFirstPulse;
+  const size_t mCapturedCount;
+  size_t mPulseIndex;
+  RcSwitchTx::TxLoopbackReport& mReport;
+
+  // Returns false, if the pulse is missing or out of tolerance.
+  bool verifyPulse(const RcSwitchTx::tx_duration_t ticksNominal) {
+    const uint32_t nominal = saturatedDuration(ticksNominal / RcSwitchTx::TICKS_PER_USEC);
+    const size_t i = mFirstPulse + mPulseIndex++;
+    if(i < mCapturedCount) {
+      const uint32_t captured = pulses[i];
+      const uint32_t deviation = captured > nominal ? captured - nominal : nominal - captured;
+      if(deviation > mReport.maxDeviation) {
+        mReport.maxDeviation = deviation;
+      }
+      mReport.pulseCount++;
+      return 100 * deviation <= static_cast<uint32_t>(nominal) * mPercentTolerance;
+    }
+    if(pulseOverflow) {
+      // The pulse has not been captured, because the capacity was exhausted.
+      return true;
+    }
+    if(i == mCapturedCount) {
+      // The very last pulse has no terminating edge, because the level is kept after transmission.
+      return true;
+    }
+    return false;
+  }
+
+public:
+  TxVerifyEmitter(const unsigned int percentTolerance, const bool firstEdgeMissing,
+      const size_t capturedCount, RcSwitchTx::TxLoopbackReport& report)
+    : mPercentTolerance(percentTolerance), mFirstPulse(firstEdgeMissing ? 0 : 1),
+      mCapturedCount(capturedCount), mPulseIndex(0), mReport(report) {
+  }
+
+  void emit(const RcSwitchTx::TxTimingSpec &timingSpec, const RcSwitchTx::TxPulsePairTime &pulsePairTime) {
+    const bool okA = verifyPulse(pulsePairTime.durationA);
+    const bool okB = verifyPulse(pulsePairTime.durationB);
+    if(not (okA && okB)) {
+      if(&pulsePairTime == &timingSpec.synchronizationPulsePair) {
+        mReport.synchErrors++;
+      } else {
+        mReport.bitErrors++;
+      }
+    }
+  }
+};
+
+} // anonymous name space
+
+namespace RcSwitchTx {
+
+void TxLoopback::begin(const int rxPin, const unsigned int percentTolerance) {
+  mRxPin = rxPin;
+  mPercentTolerance = percentTolerance;
+  pinMode(mRxPin, INPUT);
+}
+
+void TxLoopback::arm() {
+  pulseCount = 0;
+  pulseOverflow = false;
+  mArmLevel = digitalRead(mRxPin);
+  lastBoundary = micros();
+  attachInterrupt(digitalPinToInterrupt(mRxPin), handleInterrupt, CHANGE);
+}
+
+void TxLoopback::disarm() {
+  detachInterrupt(digitalPinToInterrupt(mRxPin));
+}
+
+bool TxLoopback::verify(const TxTimingSpec &timingSpec, const uint32_t* const dwords,
+    const size_t totalBitCount, const size_t repeatCount, TxLoopbackReport& report) const {
+  report = TxLoopbackReport{0, 0, 0, 0, pulseOverflow};
+  // The level of the first pulse doesn't produce an edge, if the pin is already at this level.
+  const int firstLevel = timingSpec.bInverseLevel ? LOW : HIGH;
+  TxVerifyEmitter emitter(mPercentTolerance, mArmLevel == firstLevel, pulseCount, report);
+  encodeFrame(emitter, timingSpec, dwords, totalBitCount, repeatCount);
+  return pulseCount > 0;
+}
+
+namespace Debug {
+
+void printLoopbackReport(serial_t &serial, const TxLoopbackReport& report) {
+  TxLineBuffer line;
+  line.put("pulses=").putDecimal(report.pulseCount);
+  line.put(" bitErrors=").putDecimal(report.bitErrors);
+  line.put(" synchErrors=").putDecimal(report.synchErrors);
+  line.put(" maxDeviation=").putDecimal(report.maxDeviation).put("usec");
+  line.put(report.truncated ? " truncated" : "");
+  line.writeLine(serial);
+}
+
+} // namespace Debug
+} // namespace RcSwitchTx
@@ -0,0 +1,137 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "../TxPayloadSource.hpp"
+
+namespace RcSwitchTx {
+
+namespace {
+
+inline uint32_t lowBitsMask(const size_t bitCount) {
+  return bitCount < 32 ? (static_cast<uint32_t>(1) << bitCount) - 1 : 0xFFFFFFFF;
+}
+
+// Limit a trailer bit count to the range, that the trailer computation supports.
+inline size_t clampBitCount(const size_t bitCount, const size_t maxBitCount) {
+  return bitCount < 1 ? 1 : (bitCount > maxBitCount ? maxBitCount : bitCount);
+}
+
+} // anonymous name space
+
+TxDwordSource::TxDwordSource(const uint32_t* const dwords, const size_t bitCount)
+  : mDwords(dwords), mBitCount(bitCount), mIndex(0), mBitPos(0) {
+  rewind();
+}
+
+void TxDwordSource::rewind() {
+  const size_t remainingBits = mBitCount % (8 * sizeof(*mDwords));
+  mIndex = 0;
+  mBitPos = (mBitCount > 8 * sizeof(*mDwords)) || not remainingBits ? 8 * sizeof(*mDwords) : remainingBits;
+}
+
+bool TxDwordSource::nextBit() {
+  if(mBitPos == 0) {
+    // Continue with the next double word.
+    const size_t remainingBits = mBitCount % (8 * sizeof(*mDwords));
+    const size_t dwordCount = (mBitCount + 8 * sizeof(*mDwords) - 1) / (8 * sizeof(*mDwords));
+    ++mIndex;
+    mBitPos = ((mIndex + 1) < dwordCount) || not remainingBits ? 8 * sizeof(*mDwords) : remainingBits;
+  }
+  --mBitPos;
+  return mDwords[mIndex] & (static_cast<uint32_t>(1) << mBitPos);
+}
+
+TxTrailerSource::TxTrailerSource(TxPayloadSource& payload, const size_t trailerBitCount)
+  : mPayload(payload), mTrailerBitCount(trailerBitCount), mPos(0) {
+}
+
+void TxTrailerSource::rewind() {
+  mPayload.rewind();
+  restart();
+  mPos = 0;
+}
+
+bool TxTrailerSource::nextBit() {
+  const size_t payloadBitCount = mPayload.bitCount();
+  if(mPos < payloadBitCount) {
+    const bool bit = mPayload.nextBit();
+    feed(bit);
+    ++mPos;
+    return bit;
+  }
+  const size_t bitPos = mTrailerBitCount - 1 - (mPos - payloadBitCount);
+  ++mPos;
+  return trailer() & (static_cast<uint32_t>(1) << bitPos);
+}
+
+TxCounterSource::TxCounterSource(TxPayloadSource& payload, const size_t counterBitCount,
+    const uint32_t startValue)
+  : TxTrailerSource(payload, clampBitCount(counterBitCount, 32)), mCounter(0),
+    mMask(lowBitsMask(clampBitCount(counterBitCount, 32))) {
+  setCounter(startValue);
+}
+
+void TxCounterSource::commit() {
+  TxTrailerSource::commit();
+  setCounter(mCounter + 1);
+}
+
+TxCrcSource::TxCrcSource(TxPayloadSource& payload, const size_t crcBitCount, const uint16_t polynomial,
+    const uint16_t init)
+  : TxTrailerSource(payload, clampBitCount(crcBitCount, 16)),
+    mMask(lowBitsMask(clampBitCount(crcBitCount, 16))),
+    mTopBit(static_cast<uint16_t>(1) << (clampBitCount(crcBitCount, 16) - 1)), mPolynomial(polynomial & mMask),
+    mInit(init & mMask), mCrc(mInit) {
+}
+
+void TxCrcSource::feed(const bool bit) {
+  const bool msb = mCrc & mTopBit;
+  mCrc = (mCrc << 1) & mMask;
+  if(msb != bit) {
+    mCrc ^= mPolynomial;
+  }
+}
+
+TxXorChecksumSource::TxXorChecksumSource(TxPayloadSource& payload, const size_t checksumBitCount)
+  : TxTrailerSource(payload, clampBitCount(checksumBitCount, 32)),
+    mChunkBitCount(clampBitCount(checksumBitCount, 32)), mChunkPos(0),
+    mChunk(0), mChecksum(0) {
+}
+
+void TxXorChecksumSource::restart() {
+  mChunkPos = 0;
+  mChunk = 0;
+  mChecksum = 0;
+}
+
+void TxXorChecksumSource::feed(const bool bit) {
+  mChunk = (mChunk << 1) | bit;
+  if(++mChunkPos == mChunkBitCount) {
+    mChecksum ^= mChunk;
+    mChunk = 0;
+    mChunkPos = 0;
+  }
+}
+
+} // namespace RcSwitchTx
@@ -6,29 +6,31 @@
  */
 
 #include <stddef.h>
-#include <stdlib.h>
+#include <stdint.h>
 #include "TxFormattedPrint.hpp"
 #include "TxProtocolTimingSpec.hpp"
 
 namespace {
 
-size_t sprintTime(char *string, const unsigned int time, const size_t width) {
-  size_t i=0;
-  RcSwitchTx::sprintNumAsDecimal(&string[i], time, width); // adds a null terminated string
-  i = strlen(string);
-  string[i] = '\0'; // ensure null termination
-  return i; // return string length
+// Durations are written in usec, or in nsec if the resolution is finer than 1 usec.
+constexpr bool NSEC = RcSwitchTx::TICKS_PER_USEC > 1;
+
+void putDuration(RcSwitchTx::TxLineBuffer& line, const RcSwitchTx::tx_duration_t ticks, const size_t width) {
+  const uint64_t time = NSEC ? (1000ULL * ticks) / RcSwitchTx::TICKS_PER_USEC : ticks;
+  if(time <= static_cast<uint32_t>(-1)) {
+    line.putDecimal(static_cast<uint32_t>(time), width);
+  } else {
+    line.putDecimal64(time);
+  }
 }
 
-inline size_t sprintTimeRanges(char* string, const RcSwitchTx::TxPulsePairTime& pulsePair, const size_t widthA, const size_t widthB) {
-  size_t i=0;
-  string[i++] = '{';
-  i += sprintTime(&string[i], pulsePair.durationA, widthA); // adds a null terminated string
-  string[i++] = ',';
-  i += sprintTime(&string[i], pulsePair.durationB, widthB); // adds a null terminated string
-  string[i++] = '}';
-  string[i] = '\0'; // ensure null termination
-  return i;
+void putPulsePair(RcSwitchTx::TxLineBuffer& line, const RcSwitchTx::TxPulsePairTime& pulsePair,
+    const size_t widthA, const size_t widthB) {
+  line.put('{');
+  putDuration(line, pulsePair.durationA, widthA);
+  line.put(',');
+  putDuration(line, pulsePair.durationB, widthB);
+  line.put('}');
 }
 
 } // anonymous name space
@@ -39,24 +41,19 @@ namespace Debug {
 
 void dumpTxTimingSpecTable(serial_t &serial, const TxTimingSpecTable &txtimingSpecTable) {
 
-  serial.println(" i,{<----SYNCH-->}{<---DATA 0-->}{<---DATA 1-->}");
-  serial.println("    PulseA,PulseB  PulseA,PulseB  PulseA,PulseB");
-  char buffer[96];
+  // Columns: row index, inverse level, pulse pairs
+  serial.println(" i,I,{<----SYNCH-->}{<---DATA 0-->}{<---DATA 1-->}");
+  serial.println(NSEC ? "      PulseA,PulseB  PulseA,PulseB  PulseA,PulseB [nsec]"
+                      : "      PulseA,PulseB  PulseA,PulseB  PulseA,PulseB [usec]");
+  TxLineBuffer line;
 
   for (size_t i = 0; i < txtimingSpecTable.size; i++) {
     const TxTimingSpec &p = txtimingSpecTable.start[i];
-    if (p.bInverseLevel) {
-      serial.print(",1,");
-    } else {
-      serial.print(",0,");
-    }
-
-    sprintTimeRanges(buffer, p.synchronizationPulsePair, 6, 6);
-    serial.print(buffer);
-    sprintTimeRanges(buffer, p.data0pulsePair, 6, 6);
-    serial.print(buffer);
-    sprintTimeRanges(buffer, p.data1pulsePair, 6, 6);
-    serial.println(buffer);
+    line.putDecimal(i, 2).put(p.bInverseLevel ? ",1," : ",0,");
+    putPulsePair(line, p.synchronizationPulsePair, 6, 6);
+    putPulsePair(line, p.data0pulsePair, 6, 6);
+    putPulsePair(line, p.data1pulsePair, 6, 6);
+    line.writeLine(serial);
   }
 }
 
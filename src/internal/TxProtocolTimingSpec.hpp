@@ -31,14 +31,25 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "TxDuration.hpp"
 #include "TxTimingSpecTable.hpp"
 
+#if not RCSWITCH_TRANSMITTER_TIMING_CORRECTION
+#if defined (ARDUINO_AVR_UNO)
+  // We need to shorten the delay on UNO, because of its delayMicroseconds() function shifts the pulses
+  // length beyond tolerance.
+  #define RCSWITCH_TRANSMITTER_TIMING_CORRECTION (40) // usec
+#else
+  #define RCSWITCH_TRANSMITTER_TIMING_CORRECTION (0)  // usec
+#endif
+#endif
 
 namespace RcSwitchTx {
 
+/** Pulse durations in ticks of 1/TICKS_PER_USEC usec. */
 struct TxPulsePairTime {
-  unsigned int durationA;
-  unsigned int durationB;
+  tx_duration_t durationA;
+  tx_duration_t durationB;
 };
 
 struct TxTimingSpec {
@@ -49,8 +60,8 @@ struct TxTimingSpec {
 };
 
 struct TxPulsePairTiming {
-  unsigned int durationA;
-  unsigned int durationB;
+  tx_duration_t durationA;
+  tx_duration_t durationB;
 };
 
 namespace Debug {
@@ -58,45 +69,201 @@ namespace Debug {
   void dumpTxTimingSpecTable(serial_t &serial, const TxTimingSpecTable &txtimingSpecTable);
 }
 
-} // namespace RcSwitch
+/** Whether clock * clocks can be stored in a pulse duration without overflow. */
+constexpr bool fitsPulseDuration(const unsigned long long clock, const unsigned int clocks) {
+  return clock * clocks <= TX_DURATION_MAX;
+}
 
 /**
- * makeTxTimingSpec
+ * Whether the pulse duration is longer than the timing correction, which the transmitter
+ * subtracts from each pulse. This also rules out zero durations.
  */
-template<
-  unsigned int usecClock,
-  unsigned int synchA,  unsigned int synchB,
-  unsigned int data0_A, unsigned int data0_B,
-  unsigned int data1_A, unsigned int data1_B,
-  bool inverseLevel>
+constexpr bool exceedsTimingCorrection(const tx_duration_t ticksDuration) {
+  return ticksDuration > RCSWITCH_TRANSMITTER_TIMING_CORRECTION * TICKS_PER_USEC;
+}
 
-struct makeTxTimingSpec { // Calculate the timing specification from the protocol definition.
+/**
+ * The timing specification for given pulse durations in ticks. Base for the
+ * makeXXXTxTimingSpec templates.
+ */
+template<bool inverseLevel,
+  tx_duration_t synchA,  tx_duration_t synchB,
+  tx_duration_t data0_A, tx_duration_t data0_B,
+  tx_duration_t data1_A, tx_duration_t data1_B>
+struct TxTimingSpecTicks {
   static constexpr bool INVERSE_LEVEL = inverseLevel;
 
-  static constexpr unsigned int uSecSynchA = usecClock * synchA;
-  static constexpr unsigned int uSecSynchB = usecClock * synchB;
+  static constexpr tx_duration_t ticksSynchA = synchA;
+  static constexpr tx_duration_t ticksSynchB = synchB;
+
+  static constexpr tx_duration_t ticksData0_A = data0_A;
+  static constexpr tx_duration_t ticksData0_B = data0_B;
 
-  static constexpr unsigned int uSecData0_A = usecClock * data0_A;
-  static constexpr unsigned int uSecData0_B = usecClock * data0_B;
+  static constexpr tx_duration_t ticksData1_A = data1_A;
+  static constexpr tx_duration_t ticksData1_B = data1_B;
 
-  static constexpr unsigned int uSecData1_A = usecClock * data1_A;
-  static constexpr unsigned int uSecData1_B = usecClock * data1_B;
+  // The transmitter shortens each delay by the timing correction to compensate its own overhead.
+  static_assert(exceedsTimingCorrection(ticksSynchA)
+      && exceedsTimingCorrection(ticksSynchB)
+      && exceedsTimingCorrection(ticksData0_A)
+      && exceedsTimingCorrection(ticksData0_B)
+      && exceedsTimingCorrection(ticksData1_A)
+      && exceedsTimingCorrection(ticksData1_B),
+      "Pulse duration is zero or not longer than the transmitter timing correction.");
 
-  typedef RcSwitchTx::TxTimingSpec tx_spec_t;
+  typedef TxTimingSpec tx_spec_t;
   static constexpr tx_spec_t TX = {INVERSE_LEVEL,
     { /* synch pulses */
-        uSecSynchA, uSecSynchB
+        ticksSynchA, ticksSynchB
     },
     {   /* LOGICAL_0 data bit pulses */
-      uSecData0_A, uSecData0_B
+      ticksData0_A, ticksData0_B
     },
     {
       /* LOGICAL_1 data bit pulses */
-      uSecData1_A, uSecData1_B
+      ticksData1_A, ticksData1_B
     },
   };
 };
 
+/** Whether 2 timing specifications produce the same pulses. */
+template<typename A, typename B> struct isSameTxTimingSpec {
+  static constexpr bool value = A::INVERSE_LEVEL == B::INVERSE_LEVEL
+      && A::ticksSynchA == B::ticksSynchA && A::ticksSynchB == B::ticksSynchB
+      && A::ticksData0_A == B::ticksData0_A && A::ticksData0_B == B::ticksData0_B
+      && A::ticksData1_A == B::ticksData1_A && A::ticksData1_B == B::ticksData1_B;
+};
+
+/** Whether timing specification T produces the same pulses as any of R. */
+template<typename T, typename ...R> struct containsTxTimingSpec {
+  static constexpr bool value = false;
+};
+
+template<typename T, typename H, typename ...R> struct containsTxTimingSpec<T, H, R...> {
+  static constexpr bool value = isSameTxTimingSpec<T, H>::value || containsTxTimingSpec<T, R...>::value;
+};
+
+} // namespace RcSwitch
+
+template<typename T, typename ...R> struct TxProtocolTable;
+
+namespace RcSwitchTx {
+
+template<typename ...T> struct TxTimingSpecList {};
+
+template<bool condition, typename T, typename F> struct selectType {
+  typedef T type;
+};
+
+template<typename T, typename F> struct selectType<false, T, F> {
+  typedef F type;
+};
+
+/** Drops the timing specifications, that produce the same pulses as a previous one. */
+template<typename LIST, typename ...R> struct uniqueTxTimingSpecs;
+
+template<typename ...U> struct uniqueTxTimingSpecs<TxTimingSpecList<U...>> {
+  typedef TxProtocolTable<U...> table_t;
+};
+
+template<typename ...U, typename H, typename ...R> struct uniqueTxTimingSpecs<TxTimingSpecList<U...>, H, R...> {
+  typedef typename selectType<containsTxTimingSpec<H, U...>::value,
+      TxTimingSpecList<U...>, TxTimingSpecList<U..., H>>::type list_t;
+  typedef typename uniqueTxTimingSpecs<list_t, R...>::table_t table_t;
+};
+
+} // namespace RcSwitch
+
+/**
+ * makeTxTimingSpecTicks
+ */
+template<
+  RcSwitchTx::tx_duration_t ticksClock,
+  unsigned int synchA,  unsigned int synchB,
+  unsigned int data0_A, unsigned int data0_B,
+  unsigned int data1_A, unsigned int data1_B,
+  bool inverseLevel>
+
+struct makeTxTimingSpecTicks // Calculate the timing specification from the protocol definition.
+  : public RcSwitchTx::TxTimingSpecTicks<inverseLevel,
+      ticksClock * synchA, ticksClock * synchB,
+      ticksClock * data0_A, ticksClock * data0_B,
+      ticksClock * data1_A, ticksClock * data1_B> {
+
+  static_assert(RcSwitchTx::fitsPulseDuration(ticksClock, synchA)
+      && RcSwitchTx::fitsPulseDuration(ticksClock, synchB)
+      && RcSwitchTx::fitsPulseDuration(ticksClock, data0_A)
+      && RcSwitchTx::fitsPulseDuration(ticksClock, data0_B)
+      && RcSwitchTx::fitsPulseDuration(ticksClock, data1_A)
+      && RcSwitchTx::fitsPulseDuration(ticksClock, data1_B),
+      "Pulse duration overflows RCSWITCH_TRANSMITTER_DURATION_TYPE. Reduce the clock or the number of clocks.");
+};
+
+/**
+ * makeTxTimingSpec
+ */
+template<
+  unsigned int usecClock,
+  unsigned int synchA,  unsigned int synchB,
+  unsigned int data0_A, unsigned int data0_B,
+  unsigned int data1_A, unsigned int data1_B,
+  bool inverseLevel>
+
+struct makeTxTimingSpec
+  : public makeTxTimingSpecTicks<usecClock * RcSwitchTx::TICKS_PER_USEC,
+      synchA, synchB, data0_A, data0_B, data1_A, data1_B, inverseLevel> {
+
+  static_assert(RcSwitchTx::fitsPulseDuration(usecClock, RcSwitchTx::TICKS_PER_USEC),
+      "Clock overflows RCSWITCH_TRANSMITTER_DURATION_TYPE.");
+};
+
+/**
+ * RxTolerance
+ */
+template<unsigned int percentTolerance, unsigned int usecMargin>
+struct RxTolerance {
+  static_assert(percentTolerance < 100, "Receiver tolerance must be less than 100%.");
+
+  /** The shortest pulse duration, that the receiver accepts for the nominal duration. */
+  static constexpr RcSwitchTx::tx_duration_t lowerBound(const RcSwitchTx::tx_duration_t ticksNominal) {
+    return (static_cast<unsigned long long>(ticksNominal) * (100 - percentTolerance) + 99) / 100;
+  }
+
+  /** The lower bound plus margin, but never more than the nominal duration. */
+  static constexpr RcSwitchTx::tx_duration_t shortest(const RcSwitchTx::tx_duration_t ticksNominal) {
+    return lowerBound(ticksNominal) + usecMargin * RcSwitchTx::TICKS_PER_USEC < ticksNominal ?
+        lowerBound(ticksNominal) + usecMargin * RcSwitchTx::TICKS_PER_USEC : ticksNominal;
+  }
+};
+
+namespace RcSwitchTx {
+
+/** Shortens each pulse of the NOMINAL timing specification as far as RX_TOLERANCE allows. */
+template<typename RX_TOLERANCE, typename NOMINAL>
+struct shortenTxTimingSpec : public TxTimingSpecTicks<NOMINAL::INVERSE_LEVEL,
+    RX_TOLERANCE::shortest(NOMINAL::ticksSynchA), RX_TOLERANCE::shortest(NOMINAL::ticksSynchB),
+    RX_TOLERANCE::shortest(NOMINAL::ticksData0_A), RX_TOLERANCE::shortest(NOMINAL::ticksData0_B),
+    RX_TOLERANCE::shortest(NOMINAL::ticksData1_A), RX_TOLERANCE::shortest(NOMINAL::ticksData1_B)> {
+};
+
+} // namespace RcSwitch
+
+/**
+ * makeShortTxTimingSpec
+ */
+template<
+  typename RX_TOLERANCE,
+  unsigned int usecClock,
+  unsigned int synchA,  unsigned int synchB,
+  unsigned int data0_A, unsigned int data0_B,
+  unsigned int data1_A, unsigned int data1_B,
+  bool inverseLevel>
+
+struct makeShortTxTimingSpec // Calculate the shortened timing specification from the protocol definition.
+  : public RcSwitchTx::shortenTxTimingSpec<RX_TOLERANCE,
+      makeTxTimingSpec<usecClock, synchA, synchB, data0_A, data0_B, data1_A, data1_B, inverseLevel> > {
+};
+
 /**
  * TxProtocolTable
  */
@@ -105,6 +272,8 @@ template<typename T, typename ...R> struct
 TxProtocolTable {
 private:
   const RcSwitchTx::TxTimingSpec* toArray() const {return &m;}
+  static_assert(not RcSwitchTx::containsTxTimingSpec<T, R...>::value,
+      "Duplicate protocol in TxProtocolTable. Remove it or use makeUniqueTxProtocolTable.");
 public:
   static constexpr size_t ROW_COUNT = sizeof(TxProtocolTable) / sizeof(RcSwitchTx::TxTimingSpec);
   RcSwitchTx::TxTimingSpec m = T::TX;
@@ -141,4 +310,10 @@ public:
   }
 };
 
+/**
+ * makeUniqueTxProtocolTable
+ */
+template<typename T, typename ...R>
+using makeUniqueTxProtocolTable = typename RcSwitchTx::uniqueTxTimingSpecs<RcSwitchTx::TxTimingSpecList<>, T, R...>::table_t;
+
 #endif // RCSWITCH_TRANSMITTER_INTERNAL_PROTOCOL_TIMING_SPEC_HPP_
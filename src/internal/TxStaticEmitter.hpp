@@ -0,0 +1,222 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCH_TRANSMITTER_INTERNAL_STATIC_EMITTER_HPP_
+#define RCSWITCH_TRANSMITTER_INTERNAL_STATIC_EMITTER_HPP_
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "RcSwitchTransmitterBase.hpp"
+#include "TxDelay.hpp"
+
+/*
+ * CPU cycles between 2 edges besides the delay loop on AVR. They are subtracted
+ * from the delays. The counts are derived from the AVR instruction timings of the
+ * code below, not measured. Adjust them, if the compiler output differs.
+ */
+#if not defined(RCSWITCH_TRANSMITTER_STATIC_WRITE_CYCLES)
+// Port write: out SREG (1) of the previous write, in SREG (1), cli (1), ld (2),
+// or / and (1), st (2). The edge happens with the st.
+#define RCSWITCH_TRANSMITTER_STATIC_WRITE_CYCLES 8
+#endif
+
+#if not defined(RCSWITCH_TRANSMITTER_STATIC_BIT_CYCLES)
+// Mask loop between 2 data bits: shift the 32 bit mask (4), test it for 0 and
+// branch (4 + 1), jump back (2), copy the dword and the mask (2), and them (4),
+// test the result for 0 and branch (3 + 2). The step from a synch to the first
+// data bit and from one dword to the next one take some cycles more, which are
+// not compensated. That is less than 0.1% of a synch.
+#define RCSWITCH_TRANSMITTER_STATIC_BIT_CYCLES 22
+#endif
+
+namespace RcSwitchTx {
+
+#if defined(__AVR__)
+
+/**
+ * Delays for compile time constant numbers of ticks with __builtin_avr_delay_cycles().
+ * Each delay is rounded to the nearest CPU cycle. The cycles, that the code between
+ * 2 edges takes, are subtracted.
+ */
+class TxStaticDelay {
+public:
+  template<tx_duration_t ticks, uint32_t overheadCycles>
+  __attribute__((always_inline)) inline void delay() {
+    constexpr unsigned long long ticksPerSecond = 1000000ULL * TICKS_PER_USEC;
+    constexpr uint32_t cycles = static_cast<uint32_t>(
+        (static_cast<unsigned long long>(ticks) * F_CPU + ticksPerSecond / 2) / ticksPerSecond);
+    constexpr uint32_t delayCycles = cycles > overheadCycles ? cycles - overheadCycles : 0;
+    if(delayCycles) {
+      __builtin_avr_delay_cycles(delayCycles);
+    }
+  }
+};
+
+/**
+ * Writes the IO pin through its port register. The port and the bit mask are
+ * looked up once per frame instead of once per edge.
+ */
+class TxStaticPin {
+  volatile uint8_t* const mOut;
+  const uint8_t mBitMask;
+
+public:
+  TxStaticPin(const int ioPin) : mOut(portOutputRegister(digitalPinToPort(ioPin))),
+    mBitMask(digitalPinToBitMask(ioPin)) {
+  }
+
+  template<bool level>
+  __attribute__((always_inline)) inline void write() {
+    // The port may be shared with pins, that are written by interrupts.
+    const uint8_t oldSREG = SREG;
+    cli();
+    if(level) {
+      *mOut |= mBitMask;
+    } else {
+      *mOut &= static_cast<uint8_t>(~mBitMask);
+    }
+    SREG = oldSREG;
+  }
+};
+
+#else
+
+/**
+ * Delays for compile time constant numbers of ticks with delayMicros(). Like the
+ * pin emitter of send(), the fraction of a microsecond is carried over to the next
+ * pulse. With 1 tick per usec, the carry is always 0 and the delays are constants.
+ * The overhead cycles are covered by RCSWITCH_TRANSMITTER_TIMING_CORRECTION instead.
+ */
+class TxStaticDelay {
+  uint32_t mTicksCarry;
+
+public:
+  TxStaticDelay() : mTicksCarry(0) {}
+
+  template<tx_duration_t ticks, uint32_t>
+  __attribute__((always_inline)) inline void delay() {
+    constexpr uint32_t ticksCorrected = static_cast<uint32_t>(ticks)
+        - RCSWITCH_TRANSMITTER_TIMING_CORRECTION * TICKS_PER_USEC;
+    const uint32_t ticksTotal = ticksCorrected + mTicksCarry;
+    delayMicros(ticksTotal / TICKS_PER_USEC);
+    mTicksCarry = ticksTotal % TICKS_PER_USEC;
+  }
+};
+
+class TxStaticPin {
+  const int mIoPin;
+
+public:
+  TxStaticPin(const int ioPin) : mIoPin(ioPin) {
+  }
+
+  template<bool level>
+  __attribute__((always_inline)) inline void write() {
+    digitalWrite(mIoPin, level ? HIGH : LOW);
+  }
+};
+
+#endif
+
+/**
+ * Emitter for one row of a TxProtocolTable. The pulse durations and levels are
+ * compile time constants.
+ */
+template<typename SPEC>
+class TxStaticPinEmitter {
+  TxStaticPin mPin;
+  TxStaticDelay mDelay;
+
+  // The B pulse also covers the cycles, that are needed to get to the next pulse pair.
+  template<tx_duration_t ticksA, tx_duration_t ticksB, uint32_t nextPairCycles>
+  __attribute__((always_inline)) inline void emit() {
+    mPin.write<not SPEC::INVERSE_LEVEL>();
+    mDelay.template delay<ticksA, RCSWITCH_TRANSMITTER_STATIC_WRITE_CYCLES>();
+    mPin.write<SPEC::INVERSE_LEVEL>();
+    mDelay.template delay<ticksB, RCSWITCH_TRANSMITTER_STATIC_WRITE_CYCLES + nextPairCycles>();
+  }
+
+public:
+  TxStaticPinEmitter(const int ioPin) : mPin(ioPin), mDelay() {}
+
+  inline void emitSynch() {
+    emit<SPEC::ticksSynchA, SPEC::ticksSynchB, 0>();
+  }
+
+  inline void emitData(const bool bit) {
+    if(bit) {
+      emit<SPEC::ticksData1_A, SPEC::ticksData1_B, RCSWITCH_TRANSMITTER_STATIC_BIT_CYCLES>();
+    } else {
+      emit<SPEC::ticksData0_A, SPEC::ticksData0_B, RCSWITCH_TRANSMITTER_STATIC_BIT_CYCLES>();
+    }
+  }
+};
+
+/**
+ * Send a frame like encodeFrame() does, but with the timing of SPEC baked in.
+ */
+template<typename SPEC>
+void sendStaticFrame(const int ioPin, const uint32_t* const dwords, const size_t totalBitCount,
+    const size_t repeatCount) {
+  TxStaticPinEmitter<SPEC> emitter(ioPin);
+  const size_t remainingBits = totalBitCount % (8 * sizeof(*dwords));
+  const size_t dwordCount = (totalBitCount + 8 * sizeof(*dwords) - 1) / (8 * sizeof(*dwords));
+
+  // Send synch at the beginning of the first repetition
+  emitter.emitSynch();
+
+  for (size_t repeat = 0; repeat < repeatCount; repeat++) {
+    for(size_t index = 0; index < dwordCount; index++) {
+      const size_t bitCount = ((index + 1) < dwordCount) || not remainingBits ? 8 * sizeof(*dwords) : remainingBits;
+      // Walk a mask instead of shifting by the bit position, which is a loop on AVR.
+      const uint32_t dword = dwords[index];
+      for (uint32_t mask = static_cast<uint32_t>(1) << (bitCount - 1); mask; mask >>= 1) {
+        emitter.emitData(dword & mask);
+      }
+    }
+
+    // Send synch at the end of each repetition
+    emitter.emitSynch();
+  }
+}
+
+/**
+ * Jump table with one sender per row of a TxProtocolTable, indexed by protocol index.
+ */
+template<typename ...T>
+struct TxStaticSenderTable {
+  static constexpr size_t ROW_COUNT = sizeof...(T);
+  static constexpr tx_static_sender_t SENDERS[ROW_COUNT] = {&sendStaticFrame<T>...};
+};
+
+template<typename ...T>
+constexpr tx_static_sender_t TxStaticSenderTable<T...>::SENDERS[];
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCH_TRANSMITTER_INTERNAL_STATIC_EMITTER_HPP_ */
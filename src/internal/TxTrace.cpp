@@ -0,0 +1,115 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#include "TxTrace.hpp"
+#include "TxFormattedPrint.hpp"
+#include "TxFrameEncoder.hpp"
+
+namespace {
+
+/**
+ * Frame encoder emitter, that writes the pulses to a serial.
+ */
+class TxTraceEmitter {
+  RcSwitchTx::Debug::serial_t& mSerial;
+  const RcSwitchTx::TX_TRACE_FORMAT mFormat;
+  uint64_t mTime; // ticks, 64 bit so that the nsec timestamps of long traces don't wrap
+
+  // Times are written in usec, or in nsec if the resolution is finer than 1 usec.
+  static constexpr bool NSEC = RcSwitchTx::TICKS_PER_USEC > 1;
+
+  void putTime(RcSwitchTx::TxLineBuffer& line, const uint64_t ticks) {
+    if(NSEC) {
+      line.putDecimal64((1000ULL * ticks) / RcSwitchTx::TICKS_PER_USEC);
+    } else {
+      line.putDecimal64(ticks);
+    }
+  }
+
+  // Each pulse is written as one line with a single write().
+  void writePulse(const bool level, const RcSwitchTx::tx_duration_t duration) {
+    RcSwitchTx::TxLineBuffer line;
+    if(mFormat == RcSwitchTx::TX_TRACE_VCD) {
+      line.put('#');
+      putTime(line, mTime);
+      line.writeLine(mSerial);
+      line.put(level ? '1' : '0').put('!');
+    } else {
+      line.put(level ? '1' : '0').put(',');
+      putTime(line, duration);
+    }
+    line.writeLine(mSerial);
+    mTime += duration;
+  }
+
+public:
+  TxTraceEmitter(RcSwitchTx::Debug::serial_t& serial, const RcSwitchTx::TX_TRACE_FORMAT format)
+    : mSerial(serial), mFormat(format), mTime(0) {
+  }
+
+  void begin() {
+    if(mFormat == RcSwitchTx::TX_TRACE_VCD) {
+      mSerial.println(NSEC ? "$timescale 1ns $end" : "$timescale 1us $end");
+      mSerial.println("$scope module rcswitch $end");
+      mSerial.println("$var wire 1 ! data $end");
+      mSerial.println("$upscope $end");
+      mSerial.println("$enddefinitions $end");
+    } else {
+      mSerial.println(NSEC ? "level,nsec" : "level,usec");
+    }
+  }
+
+  void end() {
+    if(mFormat == RcSwitchTx::TX_TRACE_VCD) {
+      // Mark the end of the last pulse.
+      RcSwitchTx::TxLineBuffer line;
+      line.put('#');
+      putTime(line, mTime);
+      line.writeLine(mSerial);
+    }
+  }
+
+  inline void emit(const RcSwitchTx::TxTimingSpec &timingSpec,
+      const RcSwitchTx::TxPulsePairTime &pulsePairTime) {
+    writePulse(not timingSpec.bInverseLevel, pulsePairTime.durationA);
+    writePulse(timingSpec.bInverseLevel, pulsePairTime.durationB);
+  }
+};
+
+} // anonymous name space
+
+namespace RcSwitchTx {
+
+namespace Debug {
+
+void traceFrame(serial_t &serial, const TxTimingSpec &timingSpec, const uint32_t* const dwords,
+    const size_t totalBitCount, const size_t repeatCount, const TX_TRACE_FORMAT format) {
+  TxTraceEmitter emitter(serial, format);
+  emitter.begin();
+  encodeFrame(emitter, timingSpec, dwords, totalBitCount, repeatCount);
+  emitter.end();
+}
+
+} // namespace Debug
+} // namespace RcSwitchTx
@@ -0,0 +1,54 @@
+/*
+  RcSwitchTransmitter - Arduino libary for remote control transmitter Copyright (c)
+  2025 Wolfgang Schmieder.  All right reserved.
+
+  Contributors:
+  - Wolfgang Schmieder
+
+  Project home: https://github.com/dac1e/RcSwitchTransmitter/
+
+  This library is free software; you can redistribute it and/or modify it
+  the terms of the GNU Lesser General Public License as under published
+  by the Free Software Foundation; either version 3.0 of the License,
+  or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+*/
+
+#pragma once
+
+#ifndef RCSWITCH_TRANSMITTER_INTERNAL_TRACE_HPP_
+#define RCSWITCH_TRANSMITTER_INTERNAL_TRACE_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TxProtocolTimingSpec.hpp"
+
+namespace RcSwitchTx {
+
+enum TX_TRACE_FORMAT {
+  TX_TRACE_CSV,   // One line per pulse: level,usec (level,nsec if TICKS_PER_USEC > 1)
+  TX_TRACE_VCD,   // Value change dump with 1 usec time scale (1 nsec if TICKS_PER_USEC > 1).
+};
+
+namespace Debug {
+  /**
+   * Write the pulses of the frame, that would be sent for the given parameters,
+   * to the serial. Each pulse is written as soon as it is encoded, so the frame
+   * is never buffered as a whole.
+   */
+  void traceFrame(serial_t &serial, const TxTimingSpec &timingSpec, const uint32_t* const dwords,
+      const size_t totalBitCount, const size_t repeatCount, const TX_TRACE_FORMAT format);
+}
+
+} // namespace RcSwitchTx
+
+#endif /* RCSWITCH_TRANSMITTER_INTERNAL_TRACE_HPP_ */